@@ -0,0 +1,142 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench {
+    /**
+     * @brief Shape of a generated input array.
+     */
+    enum class Distribution : std::int64_t {
+        Sorted,
+        Reversed,
+        Random,
+        FewUnique  ///< Random values drawn from only 16 distinct keys
+    };
+
+    inline const char* distribution_name(Distribution distribution) {
+        switch (distribution) {
+            case Distribution::Sorted: return "sorted";
+            case Distribution::Reversed: return "reversed";
+            case Distribution::Random: return "random";
+            case Distribution::FewUnique: return "few_unique";
+        }
+        return "unknown";
+    }
+
+    inline constexpr std::uint64_t seed = 0x5eed'1234'abcdULL;
+
+    /**
+     * @brief Returns size values of the given distribution; the same arguments always give the same array.
+     */
+    inline std::vector<std::int32_t> make_input(std::size_t size, Distribution distribution) {
+        std::vector<std::int32_t> data(size);
+        std::mt19937_64 engine(seed);
+        switch (distribution) {
+            case Distribution::Sorted:
+            case Distribution::Reversed:
+                for (std::size_t i = 0; i < size; ++i) data[i] = static_cast<std::int32_t>(2 * i);
+                if (distribution == Distribution::Reversed) std::reverse(data.begin(), data.end());
+                break;
+            case Distribution::Random: {
+                std::uniform_int_distribution<std::int32_t> values;
+                for (auto& value : data) value = values(engine);
+                break;
+            }
+            case Distribution::FewUnique: {
+                std::uniform_int_distribution<std::int32_t> values(0, 15);
+                for (auto& value : data) value = values(engine);
+                break;
+            }
+        }
+        return data;
+    }
+
+    /**
+     * @brief Element counts from L1-resident (4 KiB of int32) to DRAM-resident (64 MiB).
+     */
+    inline constexpr std::int64_t smallest_size = std::int64_t{1} << 10;
+    inline constexpr std::int64_t largest_size = std::int64_t{1} << 24;
+
+    /**
+     * @brief Adds every (size, distribution) pair, sizes growing by 4x from first to last.
+     */
+    inline void add_sizes_and_distributions(benchmark::internal::Benchmark* b, std::int64_t first, std::int64_t last) {
+        b->ArgNames({"n", "dist"});
+        for (std::int64_t size = first; size <= last; size *= 4) {
+            for (auto distribution : {Distribution::Sorted, Distribution::Reversed, Distribution::Random,
+                                      Distribution::FewUnique}) {
+                b->Args({size, static_cast<std::int64_t>(distribution)});
+            }
+        }
+    }
+
+    /**
+     * @brief Adds every distribution at every size from L1-resident to DRAM-resident.
+     */
+    inline void sizes_and_distributions(benchmark::internal::Benchmark* b) {
+        add_sizes_and_distributions(b, smallest_size, largest_size);
+    }
+
+    /**
+     * @brief Adds sizes growing by 4x from first to last.
+     */
+    inline void add_sizes(benchmark::internal::Benchmark* b, std::int64_t first, std::int64_t last) {
+        b->ArgName("n");
+        for (std::int64_t size = first; size <= last; size *= 4) b->Arg(size);
+    }
+
+    /**
+     * @brief Adds every size from L1-resident to DRAM-resident.
+     */
+    inline void sizes(benchmark::internal::Benchmark* b) {
+        add_sizes(b, smallest_size, largest_size);
+    }
+
+    inline Distribution distribution_arg(const benchmark::State& state) {
+        return static_cast<Distribution>(state.range(1));
+    }
+
+    /**
+     * @brief Reports elements and bytes per second for a run touching elements values of element_bytes each.
+     */
+    inline void report_throughput(benchmark::State& state, std::size_t elements, std::size_t element_bytes) {
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(elements));
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                                static_cast<std::int64_t>(elements * element_bytes));
+    }
+
+    /**
+     * @brief Returns count keys to look up: every other one taken from sorted, the rest one past a present key.
+     *
+     * A sampled INT32_MAX is kept as is, since one past it is not representable.
+     */
+    inline std::vector<std::int32_t> make_queries(const std::vector<std::int32_t>& sorted, std::size_t count) {
+        std::vector<std::int32_t> queries(count);
+        std::mt19937_64 engine(seed + 1);
+        std::uniform_int_distribution<std::size_t> index(0, sorted.empty() ? 0 : sorted.size() - 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::int32_t key = sorted.empty() ? 0 : sorted[index(engine)];
+            queries[i] = (i % 2 == 0 || key == std::numeric_limits<std::int32_t>::max()) ? key : key + 1;
+        }
+        return queries;
+    }
+
+    /**
+     * @brief Labels the run with its working set size, e.g. "4KiB random", so cache levels are easy to spot.
+     */
+    inline void label_run(benchmark::State& state, std::size_t bytes, const char* suffix = nullptr) {
+        std::string label = bytes >= (std::size_t{1} << 20) ? std::to_string(bytes >> 20) + "MiB"
+                          : bytes >= (std::size_t{1} << 10) ? std::to_string(bytes >> 10) + "KiB"
+                          : std::to_string(bytes) + "B";
+        if (suffix != nullptr) label += std::string(" ") + suffix;
+        state.SetLabel(label);
+    }
+}
@@ -0,0 +1,75 @@
+#include "bench_data.hpp"
+
+#include "dynamic_programming/fibonacci.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace {
+    // Unsigned arithmetic wraps for n > 93, which keeps every index valid and costs the same.
+    // n goes through DoNotOptimize so the constexpr routines cannot be folded away.
+    template<typename Fibonacci>
+    void run_fibonacci(benchmark::State& state, Fibonacci fibonacci) {
+        auto n = static_cast<std::uint64_t>(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(n);
+            auto value = fibonacci(n);
+            benchmark::DoNotOptimize(value);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    void fibonacci(benchmark::State& state) {
+        run_fibonacci(state, [](std::uint64_t n) {
+            return algorithms::dynamic_programming::fibonacci<std::uint64_t>(static_cast<int>(n));
+        });
+    }
+
+    void fibonacci_doubling(benchmark::State& state) {
+        run_fibonacci(state, [](std::uint64_t n) {
+            return algorithms::dynamic_programming::fibonacci_doubling<std::uint64_t>(n);
+        });
+    }
+
+    void fibonacci_mod(benchmark::State& state) {
+        run_fibonacci(state, [](std::uint64_t n) {
+            return algorithms::dynamic_programming::fibonacci_mod(n, 1'000'000'007);
+        });
+    }
+
+    void fibonacci_lookup(benchmark::State& state) {
+        run_fibonacci(state, [](std::uint64_t n) {
+            return algorithms::dynamic_programming::fibonacci_lookup<std::uint64_t>(static_cast<std::size_t>(n));
+        });
+    }
+
+    void fibonacci_fill(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        std::vector<std::uint64_t> out(size);
+        for (auto _ : state) {
+            algorithms::dynamic_programming::fibonacci_fill(std::span<std::uint64_t>(out));
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        bench::report_throughput(state, size, sizeof(std::uint64_t));
+        bench::label_run(state, size * sizeof(std::uint64_t));
+    }
+
+    void fibonacci_indices(benchmark::internal::Benchmark* b) {
+        b->ArgName("n");
+        b->RangeMultiplier(8)->Range(8, std::int64_t{1} << 20);
+    }
+
+    // Every index the uint64 table holds
+    void lookup_indices(benchmark::internal::Benchmark* b) {
+        b->ArgName("n");
+        b->Arg(0)->Arg(10)->Arg(50)->Arg(93);
+    }
+}
+
+BENCHMARK(fibonacci)->Apply(fibonacci_indices);
+BENCHMARK(fibonacci_doubling)->Apply(fibonacci_indices);
+BENCHMARK(fibonacci_mod)->Apply(fibonacci_indices);
+BENCHMARK(fibonacci_lookup)->Apply(lookup_indices);
+BENCHMARK(fibonacci_fill)->Apply(bench::sizes);
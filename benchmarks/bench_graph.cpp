@@ -0,0 +1,160 @@
+#include "bench_data.hpp"
+
+#include "graph/breadth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/depth_first_search.hpp"
+#include "graph/parallel_breadth_first_search.hpp"
+#include "graph/traversal_workspace.hpp"
+#include "utils/parallel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace {
+    inline constexpr std::uint32_t average_degree = 8;
+
+    /**
+     * @brief Same edges as the CSR graph, one heap-allocated vector per node, as a layout baseline.
+     */
+    struct AdjacencyListGraph {
+        using NodeType = std::uint32_t;
+        std::vector<std::vector<std::uint32_t>> adjacency;
+
+        const std::vector<std::uint32_t>& get_neighbors(std::uint32_t node) const { return adjacency[node]; }
+        std::ranges::iota_view<std::uint32_t, std::uint32_t> get_all_nodes() const {
+            return std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(adjacency.size()));
+        }
+        std::size_t node_count() const { return adjacency.size(); }
+    };
+
+    struct RandomGraph {
+        algorithms::graph::CsrGraph<> csr;
+        AdjacencyListGraph adjacency_list;
+    };
+
+    // Uniform random targets: no locality, so traversals of large graphs are bound by memory latency.
+    // Built once per size; the framework calls each benchmark several times while calibrating.
+    const RandomGraph& random_graph(std::size_t node_count) {
+        static std::map<std::size_t, std::unique_ptr<RandomGraph>> graphs;
+        auto& graph = graphs[node_count];
+        if (!graph) {
+            std::mt19937_64 engine(bench::seed);
+            std::uniform_int_distribution<std::uint32_t> target(0, static_cast<std::uint32_t>(node_count - 1));
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+            edges.reserve(node_count * average_degree);
+            AdjacencyListGraph adjacency_list{std::vector<std::vector<std::uint32_t>>(node_count)};
+            for (std::uint32_t u = 0; u < node_count; ++u) {
+                for (std::uint32_t k = 0; k < average_degree; ++k) {
+                    const auto v = target(engine);
+                    edges.emplace_back(u, v);
+                    adjacency_list.adjacency[u].push_back(v);
+                }
+            }
+            graph = std::make_unique<RandomGraph>(
+                RandomGraph{algorithms::graph::CsrGraph<>(node_count, edges), std::move(adjacency_list)});
+        }
+        return *graph;
+    }
+
+    template<typename Traverse>
+    void run_traversal(benchmark::State& state, Traverse traverse) {
+        const auto node_count = static_cast<std::size_t>(state.range(0));
+        const auto& graph = random_graph(node_count);
+
+        std::size_t visited = 0;
+        for (auto _ : state) {
+            visited = 0;
+            traverse(graph, [&visited](std::uint32_t) { ++visited; });
+            benchmark::DoNotOptimize(visited);
+        }
+
+        // Throughput in edges per second, the usual traversal metric
+        bench::report_throughput(state, graph.csr.edge_count(), sizeof(std::uint32_t));
+        bench::label_run(state, graph.csr.edge_count() * sizeof(std::uint32_t) +
+                                (node_count + 1) * sizeof(std::size_t));
+        state.counters["visited"] = static_cast<double>(visited);
+    }
+
+    void bfs_iterative(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::bfs_iterative(graph.csr, 0, visit);
+        });
+    }
+
+    void bfs_iterative_workspace(benchmark::State& state) {
+        algorithms::graph::TraversalWorkspace<algorithms::graph::CsrGraph<>> workspace;
+        run_traversal(state, [&workspace](const RandomGraph& graph, auto visit) {
+            algorithms::graph::bfs_iterative(graph.csr, 0, visit, workspace);
+        });
+    }
+
+    void bfs_iterative_adjacency_list(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::bfs_iterative(graph.adjacency_list, 0, visit);
+        });
+    }
+
+    void parallel_bfs_iterative(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{}, graph.csr, 0, visit);
+        });
+    }
+
+    void bfs_complete(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::bfs_complete(graph.csr, visit);
+        });
+    }
+
+    void dfs_iterative(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::dfs_iterative(graph.csr, 0, visit);
+        });
+    }
+
+    void dfs_iterative_workspace(benchmark::State& state) {
+        algorithms::graph::TraversalWorkspace<algorithms::graph::CsrGraph<>> workspace;
+        run_traversal(state, [&workspace](const RandomGraph& graph, auto visit) {
+            algorithms::graph::dfs_iterative(graph.csr, 0, visit, workspace);
+        });
+    }
+
+    void dfs_iterative_adjacency_list(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::dfs_iterative(graph.adjacency_list, 0, visit);
+        });
+    }
+
+    void dfs_recursive(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::dfs_recursive(graph.csr, 0, visit);
+        });
+    }
+
+    void dfs_complete(benchmark::State& state) {
+        run_traversal(state, [](const RandomGraph& graph, auto visit) {
+            algorithms::graph::dfs_complete(graph.csr, visit);
+        });
+    }
+
+    // CSR bytes per node are about 40, so this spans 40 KiB to 40 MiB
+    void graph_sizes(benchmark::internal::Benchmark* b) {
+        bench::add_sizes(b, std::int64_t{1} << 10, std::int64_t{1} << 20);
+    }
+}
+
+BENCHMARK(bfs_iterative)->Apply(graph_sizes);
+BENCHMARK(bfs_iterative_workspace)->Apply(graph_sizes);
+BENCHMARK(bfs_iterative_adjacency_list)->Apply(graph_sizes);
+BENCHMARK(parallel_bfs_iterative)->Apply(graph_sizes)->UseRealTime();
+BENCHMARK(bfs_complete)->Apply(graph_sizes);
+BENCHMARK(dfs_iterative)->Apply(graph_sizes);
+BENCHMARK(dfs_iterative_workspace)->Apply(graph_sizes);
+BENCHMARK(dfs_iterative_adjacency_list)->Apply(graph_sizes);
+BENCHMARK(dfs_recursive)->Apply(graph_sizes);
+BENCHMARK(dfs_complete)->Apply(graph_sizes);
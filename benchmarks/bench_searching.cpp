@@ -0,0 +1,116 @@
+#include "bench_data.hpp"
+
+#include "searching/binary_search.hpp"
+#include "searching/linear_search.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    inline constexpr std::size_t query_batch = 1024;
+
+    // Sorted arrays are the same for every source distribution except FewUnique,
+    // which adds long runs of equal keys
+    void search_inputs(benchmark::internal::Benchmark* b) {
+        b->ArgNames({"n", "dist"});
+        for (std::int64_t size = bench::smallest_size; size <= bench::largest_size; size *= 4) {
+            b->Args({size, static_cast<std::int64_t>(bench::Distribution::Random)});
+            b->Args({size, static_cast<std::int64_t>(bench::Distribution::FewUnique)});
+        }
+    }
+
+    // Each iteration looks up a batch of random keys, so every probe past the first
+    // few levels of a large array misses the cache as it would in real use
+    template<typename Search>
+    void run_lookups(benchmark::State& state, Search search) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const auto distribution = bench::distribution_arg(state);
+        auto data = bench::make_input(size, distribution);
+        std::sort(data.begin(), data.end());
+        const auto queries = bench::make_queries(data, query_batch);
+
+        for (auto _ : state) {
+            std::size_t checksum = 0;
+            for (const auto query : queries) checksum += search(data.begin(), data.end(), query);
+            benchmark::DoNotOptimize(checksum);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * query_batch));
+        bench::label_run(state, size * sizeof(std::int32_t), bench::distribution_name(distribution));
+    }
+
+    void binary_search(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            return static_cast<std::size_t>(algorithms::searching::binary_search(first, last, value) - first);
+        });
+    }
+
+    void lower_bound(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            return static_cast<std::size_t>(algorithms::searching::lower_bound(first, last, value) - first);
+        });
+    }
+
+    void equal_range(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            const auto [low, high] = algorithms::searching::equal_range(first, last, value);
+            return static_cast<std::size_t>(high - low);
+        });
+    }
+
+    void std_binary_search(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            return static_cast<std::size_t>(std::binary_search(first, last, value));
+        });
+    }
+
+    void std_lower_bound(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            return static_cast<std::size_t>(std::lower_bound(first, last, value) - first);
+        });
+    }
+
+    void std_equal_range(benchmark::State& state) {
+        run_lookups(state, [](auto first, auto last, std::int32_t value) {
+            const auto [low, high] = std::equal_range(first, last, value);
+            return static_cast<std::size_t>(high - low);
+        });
+    }
+
+    // Searches for a value that is not present, so every iteration scans the whole array
+    template<typename Search>
+    void run_scan(benchmark::State& state, Search search) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const auto distribution = bench::distribution_arg(state);
+        auto data = bench::make_input(size, distribution);
+        const std::int32_t missing = -1;
+        std::replace(data.begin(), data.end(), missing, std::int32_t{0});
+
+        for (auto _ : state) {
+            auto found = search(data.begin(), data.end(), missing);
+            benchmark::DoNotOptimize(found);
+        }
+
+        bench::report_throughput(state, size, sizeof(std::int32_t));
+        bench::label_run(state, size * sizeof(std::int32_t), bench::distribution_name(distribution));
+    }
+
+    void linear_search(benchmark::State& state) {
+        run_scan(state, [](auto first, auto last, std::int32_t value) {
+            return algorithms::searching::linear_search(first, last, value);
+        });
+    }
+
+    void std_find(benchmark::State& state) {
+        run_scan(state, [](auto first, auto last, std::int32_t value) { return std::find(first, last, value); });
+    }
+}
+
+BENCHMARK(binary_search)->Apply(search_inputs);
+BENCHMARK(lower_bound)->Apply(search_inputs);
+BENCHMARK(equal_range)->Apply(search_inputs);
+BENCHMARK(std_binary_search)->Apply(search_inputs);
+BENCHMARK(std_lower_bound)->Apply(search_inputs);
+BENCHMARK(std_equal_range)->Apply(search_inputs);
+BENCHMARK(linear_search)->Apply(search_inputs);
+BENCHMARK(std_find)->Apply(search_inputs);
@@ -0,0 +1,82 @@
+#include "bench_data.hpp"
+
+#include "sorting/bubble_sort.hpp"
+#include "sorting/merge_sort.hpp"
+#include "sorting/parallel_merge_sort.hpp"
+#include "sorting/pdq_sort.hpp"
+#include "sorting/radix_sort.hpp"
+#include "utils/parallel.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    // Every iteration sorts a fresh copy of the same input. The copy is timed too,
+    // which adds the same O(n) to every sort and keeps small sizes free of the much
+    // larger PauseTiming/ResumeTiming overhead.
+    template<typename Sort>
+    void run_sort(benchmark::State& state, Sort sort) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const auto distribution = bench::distribution_arg(state);
+        const auto input = bench::make_input(size, distribution);
+        std::vector<std::int32_t> work(size);
+
+        for (auto _ : state) {
+            std::copy(input.begin(), input.end(), work.begin());
+            sort(work.begin(), work.end());
+            benchmark::DoNotOptimize(work.data());
+            benchmark::ClobberMemory();
+        }
+
+        bench::report_throughput(state, size, sizeof(std::int32_t));
+        bench::label_run(state, size * sizeof(std::int32_t), bench::distribution_name(distribution));
+    }
+
+    void merge_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { algorithms::sorting::merge_sort(first, last); });
+    }
+
+    void merge_sort_bottom_up(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { algorithms::sorting::merge_sort_bottom_up(first, last); });
+    }
+
+    void parallel_merge_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) {
+            algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{}, first, last);
+        });
+    }
+
+    void pdq_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { algorithms::sorting::pdq_sort(first, last); });
+    }
+
+    void radix_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { algorithms::sorting::radix_sort(first, last); });
+    }
+
+    void bubble_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { algorithms::sorting::bubble_sort(first, last); });
+    }
+
+    void std_stable_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { std::stable_sort(first, last); });
+    }
+
+    void std_sort(benchmark::State& state) {
+        run_sort(state, [](auto first, auto last) { std::sort(first, last); });
+    }
+
+    // Quadratic: stop once a single run would take seconds
+    void bubble_sort_sizes(benchmark::internal::Benchmark* b) {
+        bench::add_sizes_and_distributions(b, bench::smallest_size, std::int64_t{1} << 14);
+    }
+}
+
+BENCHMARK(merge_sort)->Apply(bench::sizes_and_distributions);
+BENCHMARK(merge_sort_bottom_up)->Apply(bench::sizes_and_distributions);
+BENCHMARK(parallel_merge_sort)->Apply(bench::sizes_and_distributions)->UseRealTime();
+BENCHMARK(pdq_sort)->Apply(bench::sizes_and_distributions);
+BENCHMARK(radix_sort)->Apply(bench::sizes_and_distributions);
+BENCHMARK(bubble_sort)->Apply(bubble_sort_sizes);
+BENCHMARK(std_stable_sort)->Apply(bench::sizes_and_distributions);
+BENCHMARK(std_sort)->Apply(bench::sizes_and_distributions);
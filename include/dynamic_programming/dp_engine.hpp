@@ -0,0 +1,343 @@
+#pragma once
+
+#include "../utils/parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace dynamic_programming {
+    /**
+     * @addtogroup dp
+     * @{
+     */
+
+    /**
+     * @brief Dense two-dimensional DP table keeping every cell.
+     *
+     * States are the cells (i, j) of a rows x cols grid, stored row-major. A
+     * one-dimensional problem is a table with a single row.
+     *
+     * @tparam T Cell type; `bool` is not supported, use `char` instead
+     */
+    template<typename T>
+    class FlatTable {
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Creates a table with every cell set to fill.
+         */
+        FlatTable(std::size_t rows, std::size_t cols, const T& fill = T{})
+            : rows_(rows), cols_(cols), cells_(rows * cols, fill) {}
+
+        std::size_t rows() const noexcept { return rows_; }
+        std::size_t cols() const noexcept { return cols_; }
+
+        T& operator()(std::size_t i, std::size_t j) noexcept { return cells_[i * cols_ + j]; }
+        const T& operator()(std::size_t i, std::size_t j) const noexcept { return cells_[i * cols_ + j]; }
+
+    private:
+        std::size_t rows_;
+        std::size_t cols_;
+        std::vector<T> cells_;
+    };
+
+    /**
+     * @brief DP table that keeps only the last `window` rows, for O(window * cols) memory.
+     *
+     * Row i shares its storage with rows i - window, i - 2 * window, ..., so it is
+     * suited to recurrences that only look back a bounded number of rows, such as
+     * edit distance or 0/1 knapsack (window 2). It must be filled in row-major order
+     * by the serial tabulate.
+     *
+     * @tparam T Cell type; `bool` is not supported, use `char` instead
+     */
+    template<typename T>
+    class RollingTable {
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Creates a table of the given logical size with every stored cell set to fill.
+         * @throws std::invalid_argument If window is zero
+         */
+        RollingTable(std::size_t rows, std::size_t cols, std::size_t window, const T& fill = T{})
+            : rows_(rows), cols_(cols), window_(window) {
+            if (window == 0) throw std::invalid_argument("window must be positive");
+            cells_.assign(std::min(rows, window) * cols, fill);
+        }
+
+        std::size_t rows() const noexcept { return rows_; }
+        std::size_t cols() const noexcept { return cols_; }
+        std::size_t window() const noexcept { return window_; }
+
+        /**
+         * @pre Row i is one of the last `window` rows written
+         */
+        T& operator()(std::size_t i, std::size_t j) noexcept { return cells_[(i % window_) * cols_ + j]; }
+        const T& operator()(std::size_t i, std::size_t j) const noexcept { return cells_[(i % window_) * cols_ + j]; }
+
+    private:
+        std::size_t rows_;
+        std::size_t cols_;
+        std::size_t window_;
+        std::vector<T> cells_;
+    };
+
+    /**
+     * @brief Fills a DP table cell by cell in row-major order.
+     *
+     * Every cell is set to `rec(i, j, table)`, where the recurrence reads earlier
+     * cells through the const table: any cell of an earlier row still held by the
+     * table, or an earlier cell of the same row.
+     *
+     * @tparam Table FlatTable or RollingTable
+     * @tparam Recurrence Callable compatible with `T(std::size_t, std::size_t, const Table&)`
+     *
+     * @param table The table to fill, which also defines the state space
+     * @param rec The recurrence
+     *
+     * @par Complexity:
+     * - Time: O(rows * cols) recurrence calls
+     * - Space: the table's own storage
+     *
+     * @par Example:
+     * ```cpp
+     * // Edit distance in O(|b|) memory
+     * algorithms::dynamic_programming::RollingTable<std::size_t> table(a.size() + 1, b.size() + 1, 2);
+     * algorithms::dynamic_programming::tabulate(table, [&](std::size_t i, std::size_t j, const auto& d) {
+     *     if (i == 0 || j == 0) return i + j;
+     *     return std::min({d(i - 1, j) + 1, d(i, j - 1) + 1, d(i - 1, j - 1) + (a[i - 1] != b[j - 1])});
+     * });
+     * std::size_t distance = table(a.size(), b.size());
+     * ```
+     *
+     * @ingroup dp
+     */
+    template<typename Table, typename Recurrence>
+    void tabulate(Table& table, Recurrence rec) {
+        const Table& view = table;
+        for (std::size_t i = 0; i < table.rows(); ++i) {
+            for (std::size_t j = 0; j < table.cols(); ++j) {
+                table(i, j) = rec(i, j, view);
+            }
+        }
+    }
+
+    namespace detail {
+        /**
+         * @brief Side of the square tiles scheduled as one task by the parallel tabulate.
+         */
+        inline constexpr std::size_t dp_tile = 64;
+    }
+
+    /**
+     * @brief Fills a FlatTable on several threads, one anti-diagonal of tiles at a time.
+     *
+     * The grid is cut into 64 x 64 tiles. When every cell depends only on cells
+     * above and to the left of it, i.e. `rec(i, j, ...)` reads cells (i', j') with
+     * i' <= i and j' <= j, all tiles on the same anti-diagonal are independent: they
+     * are computed concurrently, each in row-major order, and the diagonals run one
+     * after the other. Edit distance, LCS and knapsack have this shape. Tiles keep
+     * the number of synchronization points at rows / 64 + cols / 64.
+     *
+     * @param policy Number of threads to use
+     * @param table The table to fill
+     * @param rec The recurrence; it is called concurrently and must be safe to do so
+     *
+     * @pre rec(i, j, table) reads no cell below or right of (i, j)
+     *
+     * @par Complexity:
+     * - Time: O(rows * cols) recurrence calls, O(rows * cols / p + (rows + cols) * 64) span
+     * - Space: the table's own storage
+     *
+     * @ingroup dp
+     */
+    template<typename T, typename Recurrence>
+    void tabulate(const utils::ParallelPolicy& policy, FlatTable<T>& table, Recurrence rec) {
+        const std::size_t thread_count = policy.resolved_thread_count();
+        const std::size_t tile_rows = (table.rows() + detail::dp_tile - 1) / detail::dp_tile;
+        const std::size_t tile_cols = (table.cols() + detail::dp_tile - 1) / detail::dp_tile;
+        if (thread_count <= 1 || tile_rows <= 1 || tile_cols <= 1) {
+            tabulate(table, rec);
+            return;
+        }
+
+        const FlatTable<T>& view = table;
+        for (std::size_t diagonal = 0; diagonal + 1 < tile_rows + tile_cols; ++diagonal) {
+            const std::size_t first = diagonal >= tile_cols ? diagonal - tile_cols + 1 : 0;
+            const std::size_t last = std::min(diagonal, tile_rows - 1);
+
+            utils::parallel_for_chunks(thread_count, last - first + 1, 1,
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    for (std::size_t tile = first + begin; tile < first + end; ++tile) {
+                        const std::size_t row_begin = tile * detail::dp_tile;
+                        const std::size_t col_begin = (diagonal - tile) * detail::dp_tile;
+                        const std::size_t row_end = std::min(table.rows(), row_begin + detail::dp_tile);
+                        const std::size_t col_end = std::min(table.cols(), col_begin + detail::dp_tile);
+                        for (std::size_t i = row_begin; i < row_end; ++i) {
+                            for (std::size_t j = col_begin; j < col_end; ++j) {
+                                table(i, j) = rec(i, j, view);
+                            }
+                        }
+                    }
+                });
+        }
+    }
+
+    /**
+     * @brief Memoization cache for hashable states, backed by one hash map.
+     *
+     * @tparam Key State type
+     * @tparam Value Result type
+     */
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class HashCache {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+
+        std::optional<Value> find(const Key& key) const {
+            auto it = entries_.find(key);
+            if (it == entries_.end()) return std::nullopt;
+            return it->second;
+        }
+
+        void insert(const Key& key, const Value& value) { entries_.try_emplace(key, value); }
+
+        std::size_t size() const noexcept { return entries_.size(); }
+
+        void clear() noexcept { entries_.clear(); }
+
+    private:
+        std::unordered_map<Key, Value, Hash, KeyEqual> entries_;
+    };
+
+    /**
+     * @brief Thread-safe memoization cache split into independently locked shards.
+     *
+     * A state is stored in the shard selected by its hash, so threads working on
+     * different states rarely contend for the same lock. Two threads may compute the
+     * same state concurrently; the first insert wins, which is harmless as long as
+     * the recurrence is a pure function of its state.
+     *
+     * @tparam Key State type
+     * @tparam Value Result type
+     * @tparam Shards Number of shards
+     */
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+             std::size_t Shards = 64>
+    class ShardedHashCache {
+        static_assert(Shards > 0, "ShardedHashCache needs at least one shard.");
+
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+
+        std::optional<Value> find(const Key& key) const {
+            const Shard& shard = shard_for(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.entries.find(key);
+            if (it == shard.entries.end()) return std::nullopt;
+            return it->second;
+        }
+
+        void insert(const Key& key, const Value& value) {
+            Shard& shard = shard_for(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.entries.try_emplace(key, value);
+        }
+
+        std::size_t size() const {
+            std::size_t total = 0;
+            for (const Shard& shard : shards_) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                total += shard.entries.size();
+            }
+            return total;
+        }
+
+        void clear() {
+            for (Shard& shard : shards_) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.entries.clear();
+            }
+        }
+
+    private:
+        struct Shard {
+            mutable std::mutex mutex;
+            std::unordered_map<Key, Value, Hash, KeyEqual> entries;
+        };
+
+        Shard& shard_for(const Key& key) { return shards_[Hash{}(key) % Shards]; }
+        const Shard& shard_for(const Key& key) const { return shards_[Hash{}(key) % Shards]; }
+
+        std::array<Shard, Shards> shards_;
+    };
+
+    namespace detail {
+        template<typename Cache, typename Recurrence>
+        struct MemoizedSolver {
+            using Key = typename Cache::key_type;
+            using Value = typename Cache::mapped_type;
+
+            Cache& cache;
+            Recurrence& rec;
+
+            Value operator()(const Key& key) const {
+                if (auto hit = cache.find(key)) return *hit;
+                Value value = rec(key, *this);
+                cache.insert(key, value);
+                return value;
+            }
+        };
+    }
+
+    /**
+     * @brief Evaluates a recurrence over hashable states top-down, caching every state.
+     *
+     * The recurrence is called as `rec(key, solve)`, where `solve(other_key)` returns
+     * the value of a sub-state, computing it on first use. Only the states reachable
+     * from key are ever evaluated, which suits sparse state spaces where a dense
+     * table would be mostly empty. With a ShardedHashCache, several threads may
+     * solve different roots concurrently and share their results.
+     *
+     * @tparam Cache HashCache, ShardedHashCache, or any type with the same find/insert interface
+     * @tparam Recurrence Callable compatible with `Value(const Key&, const Solve&)`
+     *
+     * @param key The state to evaluate
+     * @param rec The recurrence
+     * @param cache Cache of evaluated states, kept across calls
+     * @return The value of key
+     *
+     * @note Recursion depth equals the longest chain of uncached dependencies.
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::dynamic_programming::HashCache<std::uint64_t, std::uint64_t> cache;
+     * auto collatz = [](std::uint64_t n, const auto& solve) -> std::uint64_t {
+     *     return n == 1 ? 0 : 1 + solve(n % 2 == 0 ? n / 2 : 3 * n + 1);
+     * };
+     * std::uint64_t steps = algorithms::dynamic_programming::solve_memoized(27ull, collatz, cache);
+     * ```
+     *
+     * @ingroup dp
+     */
+    template<typename Cache, typename Recurrence>
+    typename Cache::mapped_type solve_memoized(const typename Cache::key_type& key, Recurrence rec, Cache& cache) {
+        return detail::MemoizedSolver<Cache, Recurrence>{cache, rec}(key);
+    }
+
+    /** @} */ // end of dp group
+
+} // namespace dynamic_programming
+} // namespace algorithms
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 
 namespace algorithms {
 namespace dynamic_programming {
@@ -26,6 +33,21 @@ namespace dynamic_programming {
         { a = b } -> std::same_as<T&>;
     };
 
+    /**
+     * @concept Multipliable
+     * @brief Concept for Addable types that also support multiplication.
+     *
+     * A Multipliable type must additionally support:
+     * - Multiplication: `a * b`
+     * - Construction from the integer literals `0` and `1`
+     *
+     * Built-in arithmetic types qualify, as do modular-integer and big-integer types.
+     */
+    template<typename T>
+    concept Multipliable = Addable<T> && std::constructible_from<T, int> && requires(T a, T b) {
+        { a * b } -> std::convertible_to<T>;
+    };
+
     /**
      * @brief Computes the n-th Fibonacci number iteratively.
      * @param n The index of the Fibonacci number to compute.
@@ -41,7 +63,7 @@ namespace dynamic_programming {
      * @ingroup dp
      */
     template<Addable T = int>
-    T fibonacci(int n, T startValue = 0, T nextValue = 1) {
+    constexpr T fibonacci(int n, T startValue = 0, T nextValue = 1) {
         if (n < 0) throw std::invalid_argument("n must be non-negative");
 
         if (n == 0) return startValue;
@@ -56,5 +78,202 @@ namespace dynamic_programming {
         }
         return v1;
     }
+
+    namespace detail {
+        /**
+         * @brief (a + b) mod m for a, b < m, without overflow.
+         */
+        constexpr std::uint64_t add_mod(std::uint64_t a, std::uint64_t b, std::uint64_t m) noexcept {
+            return a >= m - b ? a - (m - b) : a + b;
+        }
+
+        /**
+         * @brief (a * b) mod m for a, b < m, without overflow.
+         */
+        constexpr std::uint64_t mul_mod(std::uint64_t a, std::uint64_t b, std::uint64_t m) noexcept {
+#if defined(__SIZEOF_INT128__)
+            __extension__ using Wide = unsigned __int128;
+            return static_cast<std::uint64_t>(static_cast<Wide>(a) * b % m);
+#else
+            std::uint64_t result = 0;
+            for (; b != 0; b >>= 1) {
+                if (b & 1) result = add_mod(result, a, m);
+                a = add_mod(a, a, m);
+            }
+            return result;
+#endif
+        }
+    }
+
+    /**
+     * @brief Computes the n-th Fibonacci number in O(log n) by fast doubling.
+     * @param n The index of the Fibonacci number to compute.
+     * @param startValue Multipliable starting value (F(0)).
+     * @param nextValue Multipliable next value (F(1)).
+     * @return The n-th Fibonacci number.
+     *
+     * Walks the bits of n from the most significant one, keeping the pair
+     * (F(k - 1), F(k)) of the standard sequence and using
+     * - F(2k - 1) = F(k - 1)^2 + F(k)^2
+     * - F(2k) = F(k) * (2 F(k - 1) + F(k))
+     *
+     * which is the square of the matrix [[1, 1], [1, 0]]^k with its redundant entries
+     * dropped, and needs no subtraction. The seeded sequence is then
+     * startValue * F(n - 1) + nextValue * F(n).
+     *
+     * Time complexity: O(log n) additions and multiplications
+     * Space complexity: O(1)
+     *
+     * @note Values grow exponentially: F(94) is the first to overflow std::uint64_t,
+     * whose arithmetic then wraps, i.e. the result is F(n) mod 2^64. Signed overflow is
+     * undefined behavior. Use fibonacci_mod or a big-integer type for large n.
+     *
+     * @ingroup dp
+     */
+    template<Multipliable T = std::uint64_t>
+    constexpr T fibonacci_doubling(std::uint64_t n, T startValue = T(0), T nextValue = T(1)) {
+        T previous = T(1); // F(-1)
+        T current = T(0);  // F(0)
+        for (int bit = 63 - std::countl_zero(n); bit >= 0; --bit) {
+            const T odd = previous * previous + current * current;
+            const T even = current * (previous + previous + current);
+            previous = odd;
+            current = even;
+            if ((n >> bit) & 1) {
+                const T next = previous + current;
+                previous = current;
+                current = next;
+            }
+        }
+        return startValue * previous + nextValue * current;
+    }
+
+    /**
+     * @brief Computes the n-th Fibonacci number modulo m in O(log n).
+     * @param n The index of the Fibonacci number to compute.
+     * @param modulus The modulus m; any value up to 2^64 - 1.
+     * @param startValue Starting value (F(0)), reduced modulo m.
+     * @param nextValue Next value (F(1)), reduced modulo m.
+     * @return F(n) mod m.
+     * @throws std::invalid_argument If modulus is zero.
+     *
+     * Same fast doubling as fibonacci_doubling, with every intermediate result reduced
+     * modulo m using overflow-free modular addition and multiplication, so n may be as
+     * large as 2^64 - 1.
+     *
+     * Time complexity: O(log n) modular multiplications
+     * Space complexity: O(1)
+     *
+     * @ingroup dp
+     */
+    constexpr std::uint64_t fibonacci_mod(std::uint64_t n, std::uint64_t modulus,
+                                          std::uint64_t startValue = 0, std::uint64_t nextValue = 1) {
+        if (modulus == 0) throw std::invalid_argument("modulus must be positive");
+
+        const std::uint64_t m = modulus;
+        std::uint64_t previous = 1 % m; // F(-1)
+        std::uint64_t current = 0;      // F(0)
+        for (int bit = 63 - std::countl_zero(n); bit >= 0; --bit) {
+            const std::uint64_t odd = detail::add_mod(detail::mul_mod(previous, previous, m),
+                                                      detail::mul_mod(current, current, m), m);
+            const std::uint64_t twice = detail::add_mod(previous, previous, m);
+            const std::uint64_t even = detail::mul_mod(current, detail::add_mod(twice, current, m), m);
+            previous = odd;
+            current = even;
+            if ((n >> bit) & 1) {
+                const std::uint64_t next = detail::add_mod(previous, current, m);
+                previous = current;
+                current = next;
+            }
+        }
+        return detail::add_mod(detail::mul_mod(startValue % m, previous, m),
+                               detail::mul_mod(nextValue % m, current, m), m);
+    }
+
+    /**
+     * @brief Writes F(0), F(1), ..., F(N - 1) to a span in one linear pass.
+     * @param out Destination of N values.
+     * @param startValue Addable starting value (F(0)).
+     * @param nextValue Addable next value (F(1)).
+     *
+     * Costs one addition per element, instead of the O(n) of calling fibonacci(n)
+     * for every n.
+     *
+     * Time complexity: O(N)
+     * Space complexity: O(1)
+     *
+     * @ingroup dp
+     */
+    template<Addable T>
+    constexpr void fibonacci_fill(std::span<T> out, T startValue = T(0), T nextValue = T(1)) {
+        if (out.empty()) return;
+        out[0] = startValue;
+        if (out.size() == 1) return;
+        out[1] = nextValue;
+        for (std::size_t i = 2; i < out.size(); ++i) {
+            out[i] = out[i - 2] + out[i - 1];
+        }
+    }
+
+    namespace detail {
+        template<typename T>
+        concept FibonacciTableType = std::is_integral_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
+
+        // Counts the standard Fibonacci numbers representable in T
+        template<FibonacciTableType T>
+        constexpr std::size_t fibonacci_table_size() {
+            T a = 0;
+            T b = 1;
+            std::size_t count = 2;
+            while (b <= std::numeric_limits<T>::max() - a) {
+                const T next = static_cast<T>(a + b);
+                a = b;
+                b = next;
+                ++count;
+            }
+            return count;
+        }
+
+        template<FibonacciTableType T>
+        constexpr auto make_fibonacci_table() {
+            std::array<T, fibonacci_table_size<T>()> table{};
+            fibonacci_fill(std::span<T>(table), T(0), T(1));
+            return table;
+        }
+    }
+
+    /**
+     * @brief Every Fibonacci number representable in the integer type T, computed at compile time.
+     *
+     * `fibonacci_table<T>[n] == fibonacci<T>(n)`; the table has 94 entries for
+     * std::uint64_t, 93 for std::int64_t and 47 for std::int32_t.
+     *
+     * @par Example:
+     * ```cpp
+     * constexpr auto& fib = algorithms::dynamic_programming::fibonacci_table<std::uint64_t>;
+     * static_assert(fib[90] == 2880067194370816120ull);
+     * ```
+     *
+     * @ingroup dp
+     */
+    template<detail::FibonacciTableType T>
+    inline constexpr auto fibonacci_table = detail::make_fibonacci_table<T>();
+
+    /**
+     * @brief Looks up F(n) in fibonacci_table.
+     * @param n The index of the Fibonacci number.
+     * @return The n-th Fibonacci number.
+     * @throws std::out_of_range If F(n) is not representable in T.
+     *
+     * Time complexity: O(1)
+     * Space complexity: O(1)
+     *
+     * @ingroup dp
+     */
+    template<detail::FibonacciTableType T = std::uint64_t>
+    constexpr T fibonacci_lookup(std::size_t n) {
+        if (n >= fibonacci_table<T>.size()) throw std::out_of_range("Fibonacci number does not fit the type");
+        return fibonacci_table<T>[n];
+    }
 }
 }
\ No newline at end of file
@@ -1,10 +1,16 @@
 #pragma once
 
 #include "graph_concept.hpp"
+#include "traversal_control.hpp"
+#include "traversal_workspace.hpp"
+#include "visited_set.hpp"
+#include "../utils/instrumentation.hpp"
+#include <cstddef>
 #include <functional>
-#include <unordered_set>
-#include <stack>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -17,39 +23,214 @@ namespace graph {
      * @{
      */
 
+    namespace detail {
+        /**
+         * @brief Level-synchronous BFS engine shared by the public BFS entry points.
+         *
+         * Keeps the current level and the next level in two vectors that are swapped
+         * after each level, so every node is pushed and read exactly once and no element
+         * is ever shifted. Nodes are visited in the same order as with a FIFO queue.
+         *
+         * @param graph The graph to traverse.
+         * @param start The starting node, which must not be marked in visited yet.
+         * @param visited Visited set shared across calls (e.g. by bfs_complete).
+         * @param current Scratch vector for the level being expanded.
+         * @param next Scratch vector for the level being discovered, of the same type.
+         * @param visit Function called for each visited node; may return a TraversalControl.
+         * @param on_level Called before each level with its depth and frontier; returning
+         *        false stops the traversal before that level is visited.
+         * @param instrumentation Told about visited nodes, examined edges, level sizes
+         *        and frontier buffer growth.
+         * @return False if the traversal was stopped early, true if it ran to completion.
+         */
+        template<typename GraphType, typename VisitedSet, typename Frontier, typename VisitFunc, typename LevelFunc,
+                 typename Instr = utils::NoInstrumentation>
+        bool bfs_levels(const GraphType& graph, typename GraphType::NodeType start, VisitedSet& visited,
+                        Frontier& current, Frontier& next,
+                        VisitFunc& visit, LevelFunc& on_level, Instr&& instrumentation = Instr{}) {
+            using NodeType = typename GraphType::NodeType;
+            constexpr bool instrumented = std::remove_cvref_t<Instr>::enabled;
+
+            current.clear();
+            next.clear();
+            visited.insert(start);
+            if constexpr (instrumented) {
+                if (current.capacity() == 0) instrumentation.count_allocations(1);
+            }
+            current.push_back(start);
+
+            for (std::size_t depth = 0; !current.empty(); ++depth) {
+                if (!on_level(depth, std::span<const NodeType>(current))) return false;
+                instrumentation.record_frontier(current.size());
+
+                for (const auto& node : current) {
+                    const auto control = invoke_visit(visit, node);
+                    instrumentation.count_nodes(1);
+                    if (control == TraversalControl::Stop) return false;
+                    if (control == TraversalControl::SkipChildren) continue;
+
+                    for (const auto& neighbor : graph.get_neighbors(node)) {
+                        instrumentation.count_edges(1);
+                        if (visited.insert(neighbor)) {
+                            if constexpr (instrumented) {
+                                if (next.size() == next.capacity()) instrumentation.count_allocations(1);
+                            }
+                            next.push_back(neighbor);
+                        }
+                    }
+                }
+
+                std::swap(current, next);
+                next.clear();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Level callback that never stops the traversal.
+         */
+        struct AllLevels {
+            template<typename Frontier>
+            constexpr bool operator()(std::size_t, const Frontier&) const noexcept { return true; }
+        };
+    }
+
     /**
      * @brief Performs iterative breadth-first search starting from a given node.
      * @tparam GraphType Graph type satisfying the Graph concept.
      * @tparam VisitFunc Callable type for node visitation.
      * @param graph The graph to traverse.
      * @param start The starting node.
-     * @param visit Function called for each visited node.
+     * @param visit Function called for each visited node. It may return a TraversalControl:
+     *        SkipChildren leaves the node's neighbors unexpanded and Stop ends the search.
      *
      * Time Complexity: O(V + E) where V is reachable vertices, E is reachable edges.
-     * Space Complexity: O(V) for visited set + queue
+     * Space Complexity: O(V) for visited set + frontier buffers
+     *
+     * For graphs satisfying IndexedGraph the visited set is a bitset of `node_count()` bits.
      *
      * @ingroup bfs
      */
     template<Graph GraphType, typename VisitFunc>
     void bfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit) {
-        std::unordered_set<typename GraphType::NodeType> visited;
-        std::vector<typename GraphType::NodeType> queue;
+        auto visited = make_visited_set(graph);
+        std::vector<typename GraphType::NodeType> current;
+        std::vector<typename GraphType::NodeType> next;
+        detail::AllLevels on_level;
 
-        queue.push_back(start);
-        visited.insert(start);
+        detail::bfs_levels(graph, start, visited, current, next, visit, on_level);
+    }
 
-        while (!queue.empty()) {
-            auto node = queue.front();
-            queue.erase(queue.begin());
-            visit(node);
+    /**
+     * @brief Performs breadth-first search using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param visit Function called for each visited node.
+     * @param workspace Visited set and frontier buffers reused across calls; reset on entry.
+     *
+     * Same traversal as the overload without a workspace. Once the workspace buffers
+     * have grown to fit the traversal, the call itself performs no allocation, which
+     * suits many short traversals, e.g. per-request reachability checks.
+     *
+     * @ingroup bfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename Allocator>
+    void bfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit,
+                       TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        detail::AllLevels on_level;
 
-            for (const auto& neighbor : graph.get_neighbors(node)) {
-                if (!visited.contains(neighbor)) {
-                    visited.insert(neighbor);
-                    queue.push_back(neighbor);
-                }
-            }
-        }
+        detail::bfs_levels(graph, start, visited, workspace.frontier(), workspace.next_frontier(), visit, on_level);
+    }
+
+    /**
+     * @brief Performs breadth-first search and reports its operation counts.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Instr Type satisfying utils::Instrumentation.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param visit Function called for each visited node; may return a TraversalControl.
+     * @param instrumentation Receives the counts of this call.
+     *
+     * Same traversal as the plain overload. Every node handed to visit and every
+     * neighbor read is counted, each level's size is recorded as a frontier, and
+     * growing a frontier buffer counts as an allocation. finish("bfs_iterative") is
+     * called when the traversal ends, including after Stop. With
+     * utils::NoInstrumentation this compiles to the plain overload.
+     *
+     * @ingroup bfs
+     */
+    template<Graph GraphType, typename VisitFunc, utils::Instrumentation Instr>
+    void bfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit,
+                       Instr& instrumentation) {
+        auto visited = make_visited_set(graph);
+        std::vector<typename GraphType::NodeType> current;
+        std::vector<typename GraphType::NodeType> next;
+        detail::AllLevels on_level;
+
+        detail::bfs_levels(graph, start, visited, current, next, visit, on_level, instrumentation);
+        instrumentation.finish("bfs_iterative");
+    }
+
+    /**
+     * @brief Performs breadth-first search one level at a time, reporting each frontier.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam LevelFunc Callable compatible with `bool(std::size_t, std::span<const NodeType>)`.
+     * @param graph The graph to traverse.
+     * @param start The starting node (depth 0).
+     * @param visit Function called for each visited node.
+     * @param on_level Called before the nodes of each level are visited, with the level's
+     *        depth and its frontier. Returning false stops the traversal, so the nodes of
+     *        that level and every deeper level are never visited.
+     *
+     * Nodes are visited in exactly the same order as bfs_iterative.
+     *
+     * Time Complexity: O(V + E) where V is reachable vertices, E is reachable edges.
+     * Space Complexity: O(V) for visited set + frontier buffers
+     *
+     * @par Example:
+     * ```cpp
+     * // Visit every node at most two hops away from node 0
+     * algorithms::graph::bfs_by_level(graph, 0, visit,
+     *     [](std::size_t depth, std::span<const int>) { return depth <= 2; });
+     * ```
+     *
+     * @ingroup bfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename LevelFunc>
+    void bfs_by_level(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit, LevelFunc on_level) {
+        auto visited = make_visited_set(graph);
+        std::vector<typename GraphType::NodeType> current;
+        std::vector<typename GraphType::NodeType> next;
+
+        detail::bfs_levels(graph, start, visited, current, next, visit, on_level);
+    }
+
+    /**
+     * @brief Performs level-by-level breadth-first search using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam LevelFunc Callable compatible with `bool(std::size_t, std::span<const NodeType>)`.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param start The starting node (depth 0).
+     * @param visit Function called for each visited node.
+     * @param on_level Called before each level; returning false stops the traversal.
+     * @param workspace Visited set and frontier buffers reused across calls; reset on entry.
+     *
+     * @ingroup bfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename LevelFunc, typename Allocator>
+    void bfs_by_level(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit, LevelFunc on_level,
+                      TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+
+        detail::bfs_levels(graph, start, visited, workspace.frontier(), workspace.next_frontier(), visit, on_level);
     }
 
     /**
@@ -60,33 +241,47 @@ namespace graph {
      * @param visit Function called for each visited node.
      *
      * Time Complexity: O(V + E) where V is all vertices, E is all edges.
-     * Space Complexity: O(V) for visited set + queue
+     * Space Complexity: O(V) for visited set + frontier buffers
+     *
+     * The frontier buffers are reused across components.
      *
      * @ingroup bfs
      */
     template<Graph GraphType, typename VisitFunc>
     void bfs_complete(const GraphType& graph, VisitFunc visit) {
-        std::unordered_set<typename GraphType::NodeType> visited;
+        auto visited = make_visited_set(graph);
+        std::vector<typename GraphType::NodeType> current;
+        std::vector<typename GraphType::NodeType> next;
+        detail::AllLevels on_level;
 
         for (const auto& start : graph.get_all_nodes()) {
             if (visited.contains(start)) continue;
 
-            std::vector<typename GraphType::NodeType> queue;
-            queue.push_back(start);
-            visited.insert(start);
+            if (!detail::bfs_levels(graph, start, visited, current, next, visit, on_level)) return;
+        }
+    }
 
-            while (!queue.empty()) {
-                auto node = queue.front();
-                queue.erase(queue.begin());
-                visit(node);
+    /**
+     * @brief Performs BFS on all connected components using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param visit Function called for each visited node.
+     * @param workspace Visited set and frontier buffers reused across calls; reset on entry.
+     *
+     * @ingroup bfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename Allocator>
+    void bfs_complete(const GraphType& graph, VisitFunc visit, TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        detail::AllLevels on_level;
 
-                for (const auto& neighbor : graph.get_neighbors(node)) {
-                    if (!visited.contains(neighbor)) {
-                        visited.insert(neighbor);
-                        queue.push_back(neighbor);
-                    }
-                }
-            }
+        for (const auto& start : graph.get_all_nodes()) {
+            if (visited.contains(start)) continue;
+
+            if (!detail::bfs_levels(graph, start, visited, workspace.frontier(), workspace.next_frontier(),
+                                    visit, on_level)) return;
         }
     }
 
@@ -94,4 +289,4 @@ namespace graph {
     /** @} */ // end of graph group
 
 } // namespace graph
-} // namespace algorithms
\ No newline at end of file
+} // namespace algorithms
@@ -0,0 +1,333 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Throws std::out_of_range unless id is a valid node id of a graph with node_count nodes.
+         */
+        template<typename Id>
+        void check_node_id(Id id, std::size_t node_count) {
+            if constexpr (std::is_signed_v<Id>) {
+                if (id < 0) throw std::out_of_range("node id must be non-negative");
+            }
+            if (static_cast<std::size_t>(id) >= node_count) {
+                throw std::out_of_range("node id must be smaller than node_count");
+            }
+        }
+
+        /**
+         * @brief Returns node_count, or throws std::out_of_range if NodeType cannot hold it.
+         *
+         * node_count itself must fit, not just the largest id, since get_all_nodes()
+         * is a view bounded by `static_cast<NodeType>(node_count)`.
+         */
+        template<typename NodeType>
+        std::size_t check_node_count(std::size_t node_count) {
+            if (node_count > static_cast<std::uintmax_t>(std::numeric_limits<NodeType>::max())) {
+                throw std::out_of_range("node_count must not exceed the largest NodeType value");
+            }
+            return node_count;
+        }
+    }
+
+    /**
+     * @brief Directed graph stored in compressed sparse row (CSR) form.
+     *
+     * The adjacency of all nodes is kept in two flat arrays: `targets` holds the
+     * neighbors of node 0, then those of node 1, and so on, while `offsets[u]` and
+     * `offsets[u + 1]` delimit the neighbors of node `u`. Neighbor lists are returned
+     * as non-owning spans into `targets`, so traversals walk the adjacency linearly
+     * without copying it.
+     *
+     * CsrGraph satisfies IndexedGraph, so BFS and DFS also use a bitset visited set.
+     *
+     * @tparam NodeT Integral node id type; nodes are `0 .. node_count() - 1`.
+     *
+     * @par Complexity:
+     * - Construction: O(V + E) time, O(V + E) space
+     * - get_neighbors: O(1)
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{0, 1}, {0, 2}, {1, 2}};
+     * algorithms::graph::CsrGraph<> graph(3, edges);
+     * algorithms::graph::bfs_iterative(graph, 0, [](std::uint32_t node) { ... });
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<std::integral NodeT = std::uint32_t>
+    class CsrGraph {
+    public:
+        using NodeType = NodeT;
+
+        /**
+         * @brief Creates an empty graph with no nodes.
+         */
+        CsrGraph() : offsets_(1, 0) {}
+
+        /**
+         * @brief Builds a graph from an edge list.
+         *
+         * Edges are bucketed by source with a counting pass, so each node's neighbors
+         * keep the relative order in which they appear in the edge list.
+         *
+         * @tparam EdgeRange Forward range of pair-like `(source, target)` elements.
+         * @param node_count Number of nodes in the graph, at most the largest NodeType value.
+         * @param edges The directed edges; both endpoints must be smaller than node_count.
+         * @throws std::out_of_range If node_count does not fit NodeType or an edge endpoint is not a valid node id.
+         */
+        template<std::ranges::forward_range EdgeRange>
+        CsrGraph(std::size_t node_count, const EdgeRange& edges)
+            : offsets_(detail::check_node_count<NodeType>(node_count) + 1, 0) {
+            for (const auto& [source, target] : edges) {
+                detail::check_node_id(source, node_count);
+                detail::check_node_id(target, node_count);
+                ++offsets_[static_cast<std::size_t>(source) + 1];
+            }
+
+            for (std::size_t i = 0; i < node_count; ++i) {
+                offsets_[i + 1] += offsets_[i];
+            }
+
+            targets_.resize(offsets_[node_count]);
+            std::vector<std::size_t> cursor(offsets_.begin(), offsets_.end() - 1);
+            for (const auto& [source, target] : edges) {
+                targets_[cursor[static_cast<std::size_t>(source)]++] = static_cast<NodeType>(target);
+            }
+        }
+
+        /**
+         * @brief Adopts already built CSR arrays.
+         * @param offsets Row offsets, of size `node_count + 1`, starting at 0 and non-decreasing.
+         * @param targets Concatenated neighbor lists, of size `offsets.back()`.
+         * @throws std::invalid_argument If the arrays do not describe a valid CSR graph.
+         * @throws std::out_of_range If node_count() does not fit NodeType or a target is not a valid node id.
+         */
+        CsrGraph(std::vector<std::size_t> offsets, std::vector<NodeType> targets)
+            : offsets_(std::move(offsets)), targets_(std::move(targets)) {
+            if (offsets_.empty() || offsets_.front() != 0 || offsets_.back() != targets_.size()) {
+                throw std::invalid_argument("offsets must start at 0 and end at targets.size()");
+            }
+            detail::check_node_count<NodeType>(node_count());
+            for (std::size_t i = 1; i < offsets_.size(); ++i) {
+                if (offsets_[i] < offsets_[i - 1]) {
+                    throw std::invalid_argument("offsets must be non-decreasing");
+                }
+            }
+            for (const auto& target : targets_) {
+                detail::check_node_id(target, node_count());
+            }
+        }
+
+        /**
+         * @brief Returns the neighbors of a node as a view into the targets array.
+         * @param node A node id smaller than node_count().
+         * @return Non-owning span valid for the lifetime of the graph.
+         */
+        std::span<const NodeType> get_neighbors(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            return std::span<const NodeType>(targets_.data() + offsets_[index],
+                                             offsets_[index + 1] - offsets_[index]);
+        }
+
+        /**
+         * @brief Returns all node ids, `0 .. node_count() - 1`, as a lazy view.
+         */
+        std::ranges::iota_view<NodeType, NodeType> get_all_nodes() const {
+            return std::views::iota(NodeType{0}, static_cast<NodeType>(node_count()));
+        }
+
+        /**
+         * @brief Returns the number of nodes.
+         */
+        std::size_t node_count() const noexcept {
+            return offsets_.size() - 1;
+        }
+
+        /**
+         * @brief Returns the number of directed edges.
+         */
+        std::size_t edge_count() const noexcept {
+            return targets_.size();
+        }
+
+        /**
+         * @brief Returns the out-degree of a node.
+         * @param node A node id smaller than node_count().
+         */
+        std::size_t degree(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            return offsets_[index + 1] - offsets_[index];
+        }
+
+        /**
+         * @brief Returns the row offsets array (size `node_count() + 1`).
+         */
+        std::span<const std::size_t> offsets() const noexcept {
+            return offsets_;
+        }
+
+        /**
+         * @brief Returns the concatenated neighbor lists (size `edge_count()`).
+         */
+        std::span<const NodeType> targets() const noexcept {
+            return targets_;
+        }
+
+    private:
+        std::vector<std::size_t> offsets_;
+        std::vector<NodeType> targets_;
+    };
+
+    /**
+     * @brief Directed graph with weighted edges, stored in CSR form.
+     *
+     * Wraps a CsrGraph with a parallel `weights` array: the weight of the edge stored
+     * at `targets()[e]` is `weights()[e]`. Satisfies both IndexedGraph and
+     * WeightedGraph, so it works with the unweighted traversals as well as the
+     * shortest-path algorithms.
+     *
+     * @tparam NodeT Integral node id type; nodes are `0 .. node_count() - 1`.
+     * @tparam WeightT Arithmetic edge weight type.
+     *
+     * @par Complexity:
+     * - Construction: O(V + E) time, O(V + E) space
+     * - get_neighbors, get_weighted_neighbors: O(1)
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::tuple<std::uint32_t, std::uint32_t, double>> roads = {{0, 1, 2.5}, {1, 2, 0.7}};
+     * algorithms::graph::WeightedCsrGraph<> graph(3, roads);
+     * auto paths = algorithms::graph::dijkstra(graph, 0);
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<std::integral NodeT = std::uint32_t, typename WeightT = double>
+    class WeightedCsrGraph {
+        static_assert(std::is_arithmetic_v<WeightT>, "Edge weights must be arithmetic.");
+
+    public:
+        using NodeType = NodeT;
+        using WeightType = WeightT;
+
+        /**
+         * @brief Creates an empty graph with no nodes.
+         */
+        WeightedCsrGraph() = default;
+
+        /**
+         * @brief Builds a graph from a weighted edge list.
+         *
+         * As with CsrGraph, each node's out-edges keep their relative order in the edge list.
+         *
+         * @tparam EdgeRange Forward range of tuple-like `(source, target, weight)` elements.
+         * @param node_count Number of nodes in the graph, at most the largest NodeType value.
+         * @param edges The directed edges; both endpoints must be smaller than node_count.
+         * @throws std::out_of_range If node_count does not fit NodeType or an edge endpoint is not a valid node id.
+         */
+        template<std::ranges::forward_range EdgeRange>
+        WeightedCsrGraph(std::size_t node_count, const EdgeRange& edges) {
+            std::vector<std::size_t> offsets(detail::check_node_count<NodeType>(node_count) + 1, 0);
+            for (const auto& [source, target, weight] : edges) {
+                detail::check_node_id(source, node_count);
+                detail::check_node_id(target, node_count);
+                ++offsets[static_cast<std::size_t>(source) + 1];
+            }
+
+            for (std::size_t i = 0; i < node_count; ++i) {
+                offsets[i + 1] += offsets[i];
+            }
+
+            std::vector<NodeType> targets(offsets[node_count]);
+            weights_.resize(offsets[node_count]);
+            std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (const auto& [source, target, weight] : edges) {
+                const std::size_t slot = cursor[static_cast<std::size_t>(source)]++;
+                targets[slot] = static_cast<NodeType>(target);
+                weights_[slot] = static_cast<WeightType>(weight);
+            }
+            graph_ = CsrGraph<NodeType>(std::move(offsets), std::move(targets));
+        }
+
+        /**
+         * @brief Returns the neighbors of a node, without weights.
+         */
+        std::span<const NodeType> get_neighbors(NodeType node) const {
+            return graph_.get_neighbors(node);
+        }
+
+        /**
+         * @brief Returns the out-edges of a node as a lazy view of `(neighbor, weight)` pairs.
+         * @param node A node id smaller than node_count().
+         */
+        auto get_weighted_neighbors(NodeType node) const {
+            const std::span<const NodeType> targets = graph_.get_neighbors(node);
+            const std::span<const WeightType> weights = edge_weights(node);
+            return std::views::iota(std::size_t{0}, targets.size()) |
+                   std::views::transform([targets, weights](std::size_t i) {
+                       return std::pair<NodeType, WeightType>(targets[i], weights[i]);
+                   });
+        }
+
+        /**
+         * @brief Returns the weights of a node's out-edges, in the order of get_neighbors.
+         * @param node A node id smaller than node_count().
+         */
+        std::span<const WeightType> edge_weights(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            const auto offsets = graph_.offsets();
+            return std::span<const WeightType>(weights_.data() + offsets[index], offsets[index + 1] - offsets[index]);
+        }
+
+        /**
+         * @brief Returns all node ids, `0 .. node_count() - 1`, as a lazy view.
+         */
+        std::ranges::iota_view<NodeType, NodeType> get_all_nodes() const {
+            return graph_.get_all_nodes();
+        }
+
+        std::size_t node_count() const noexcept { return graph_.node_count(); }
+
+        std::size_t edge_count() const noexcept { return graph_.edge_count(); }
+
+        std::size_t degree(NodeType node) const { return graph_.degree(node); }
+
+        /**
+         * @brief Returns the unweighted CSR structure.
+         */
+        const CsrGraph<NodeType>& topology() const noexcept { return graph_; }
+
+        /**
+         * @brief Returns the edge weights array (size `edge_count()`), aligned with `topology().targets()`.
+         */
+        std::span<const WeightType> weights() const noexcept { return weights_; }
+
+    private:
+        CsrGraph<NodeType> graph_;
+        std::vector<WeightType> weights_;
+    };
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
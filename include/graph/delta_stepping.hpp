@@ -0,0 +1,212 @@
+#pragma once
+
+#include "dijkstra.hpp"
+#include "graph_concept.hpp"
+#include "../utils/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup shortest_paths
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Nodes relaxed at once by a delta-stepping worker.
+         */
+        inline constexpr std::size_t relax_grain = 64;
+
+        /**
+         * @brief Most buckets in the delta-stepping ring; smaller deltas are raised to fit.
+         */
+        inline constexpr std::size_t max_bucket_ring = std::size_t{1} << 20;
+
+        /**
+         * @brief Lowers distance to candidate unless it already holds a smaller value.
+         * @return True if distance was lowered.
+         */
+        template<typename WeightType>
+        bool fetch_min(std::atomic<WeightType>& distance, WeightType candidate) noexcept {
+            WeightType current = distance.load(std::memory_order_relaxed);
+            while (candidate < current) {
+                if (distance.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) return true;
+            }
+            return false;
+        }
+    }
+
+    /**
+     * @brief Computes shortest-path distances from a source on several threads by delta-stepping.
+     *
+     * Nodes are kept in buckets of width delta by tentative distance. The lowest
+     * non-empty bucket is settled in parallel: its nodes relax their light edges
+     * (weight <= delta), which may refill the same bucket, until it stays empty; then
+     * all nodes settled in that bucket relax their heavy edges once. Every phase
+     * relaxes a whole bucket at once instead of one node, which is what exposes
+     * parallelism compared to Dijkstra. A small delta approaches Dijkstra, a large one
+     * Bellman-Ford; the average edge weight is a reasonable start.
+     *
+     * Buckets live in a ring of `max_weight / delta + 2` slots, the most that can be
+     * non-empty at once, so memory does not grow with the largest distance. A delta
+     * so small that the ring would exceed 2^20 slots is raised to
+     * `max_weight / 2^20`; any positive delta gives the same distances.
+     *
+     * @tparam GraphType Type satisfying both IndexedGraph and WeightedGraph
+     *
+     * @param policy Number of threads to use
+     * @param graph The graph; every edge weight must be non-negative
+     * @param source The node to measure distances from
+     * @param delta Bucket width, greater than zero
+     * @return Distance of every node, ShortestPaths::infinity() for unreached nodes and,
+     *         as with dijkstra, for nodes farther than the largest WeightType value
+     * @throws std::out_of_range If source is not a node of the graph
+     * @throws std::invalid_argument If delta is not positive or a negative or non-finite edge weight is encountered
+     *
+     * @note Unlike dijkstra, only distances are returned; with zero-weight cycles the
+     * concurrent relaxations do not define a unique parent tree.
+     *
+     * @par Complexity:
+     * - Time: O(V + E) work per reinsertion round; O(V + E + (L / delta) * rounds) overall for
+     *   maximum distance L
+     * - Space: O(V + E / p) plus the bucket ring
+     *
+     * @par Example:
+     * ```cpp
+     * auto distance = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{16},
+     *                                                   roads, depot, 250.0);
+     * ```
+     *
+     * @ingroup shortest_paths
+     */
+    template<typename GraphType>
+        requires IndexedGraph<GraphType> && WeightedGraph<GraphType>
+    std::vector<typename GraphType::WeightType>
+    delta_stepping(const utils::ParallelPolicy& policy, const GraphType& graph,
+                   typename GraphType::NodeType source, typename GraphType::WeightType delta) {
+        using NodeType = typename GraphType::NodeType;
+        using WeightType = typename GraphType::WeightType;
+        constexpr WeightType infinity = ShortestPaths<NodeType, WeightType>::infinity();
+
+        detail::check_source(graph, source);
+        if (!(delta > WeightType{0})) throw std::invalid_argument("delta must be positive");
+
+        const auto node_count = static_cast<std::size_t>(graph.node_count());
+        const std::size_t thread_count = policy.resolved_thread_count();
+
+        // The heaviest edge bounds how far ahead of the current bucket a node can land
+        std::vector<WeightType> local_max(thread_count, WeightType{0});
+        utils::parallel_for_chunks(thread_count, node_count, detail::relax_grain * 16,
+            [&](std::size_t thread, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    for (auto&& edge : graph.get_weighted_neighbors(static_cast<NodeType>(i))) {
+                        const auto weight = static_cast<WeightType>(std::get<1>(edge));
+                        detail::check_weight(weight);
+                        local_max[thread] = std::max(local_max[thread], weight);
+                    }
+                }
+            });
+        const WeightType max_weight = *std::max_element(local_max.begin(), local_max.end());
+        if constexpr (std::is_floating_point_v<WeightType>) {
+            if (!(max_weight / delta <= static_cast<WeightType>(detail::max_bucket_ring))) {
+                delta = max_weight / static_cast<WeightType>(detail::max_bucket_ring);
+            }
+        } else if (static_cast<std::size_t>(max_weight / delta) > detail::max_bucket_ring) {
+            delta = static_cast<WeightType>(static_cast<std::size_t>(max_weight) / detail::max_bucket_ring + 1);
+        }
+        const std::size_t ring_size = static_cast<std::size_t>(max_weight / delta) + 2;
+
+        std::vector<std::atomic<WeightType>> distance(node_count);
+        for (auto& d : distance) d.store(infinity, std::memory_order_relaxed);
+        auto bucket_of = [delta](WeightType d) { return static_cast<std::size_t>(d / delta); };
+
+        std::vector<std::vector<NodeType>> ring(ring_size);
+        std::size_t pending = 0;
+        std::vector<std::vector<NodeType>> requests(thread_count);
+        auto collect = [&] {
+            for (auto& local : requests) {
+                for (const auto& node : local) {
+                    const WeightType d = distance[static_cast<std::size_t>(node)].load(std::memory_order_relaxed);
+                    ring[bucket_of(d) % ring_size].push_back(node);
+                    ++pending;
+                }
+                local.clear();
+            }
+        };
+
+        // Relaxes the light or the heavy out-edges of every node in nodes
+        auto relax = [&](const std::vector<NodeType>& nodes, bool light) {
+            utils::parallel_for_chunks(thread_count, nodes.size(), detail::relax_grain,
+                [&](std::size_t thread, std::size_t begin, std::size_t end) {
+                    for (std::size_t k = begin; k < end; ++k) {
+                        const NodeType node = nodes[k];
+                        const WeightType base = distance[static_cast<std::size_t>(node)].load(std::memory_order_relaxed);
+                        for (auto&& edge : graph.get_weighted_neighbors(node)) {
+                            const auto weight = static_cast<WeightType>(std::get<1>(edge));
+                            if ((weight <= delta) != light) continue;
+                            const auto neighbor = static_cast<NodeType>(std::get<0>(edge));
+                            if (detail::fetch_min(distance[static_cast<std::size_t>(neighbor)],
+                                                  detail::path_length(base, weight))) {
+                                requests[thread].push_back(neighbor);
+                            }
+                        }
+                    }
+                });
+            collect();
+        };
+
+        distance[static_cast<std::size_t>(source)].store(WeightType{0}, std::memory_order_relaxed);
+        ring[0].push_back(source);
+        pending = 1;
+
+        std::vector<WeightType> settled_at(node_count, infinity);
+        std::vector<char> in_settled(node_count, 0);
+        std::vector<NodeType> frontier;
+        std::vector<NodeType> settled;
+
+        for (std::size_t bucket = 0; pending > 0; ++bucket) {
+            auto& slot = ring[bucket % ring_size];
+            while (!slot.empty()) {
+                frontier.clear();
+                std::swap(frontier, slot);
+                pending -= frontier.size();
+
+                // Drop stale and duplicate entries: keep nodes whose distance still falls
+                // in this bucket and improved since they were last expanded
+                std::size_t kept = 0;
+                for (const auto& node : frontier) {
+                    const auto index = static_cast<std::size_t>(node);
+                    const WeightType d = distance[index].load(std::memory_order_relaxed);
+                    if (bucket_of(d) != bucket || !(d < settled_at[index])) continue;
+                    settled_at[index] = d;
+                    frontier[kept++] = node;
+                    if (!in_settled[index]) {
+                        in_settled[index] = 1;
+                        settled.push_back(node);
+                    }
+                }
+                frontier.resize(kept);
+                relax(frontier, true);
+            }
+
+            relax(settled, false);
+            for (const auto& node : settled) in_settled[static_cast<std::size_t>(node)] = 0;
+            settled.clear();
+        }
+
+        std::vector<WeightType> result(node_count);
+        for (std::size_t i = 0; i < node_count; ++i) result[i] = distance[i].load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /** @} */ // end of shortest_paths group
+
+} // namespace graph
+} // namespace algorithms
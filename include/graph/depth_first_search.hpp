@@ -1,10 +1,13 @@
 #pragma once
 
 #include "graph_concept.hpp"
-#include <functional>
-#include <unordered_set>
-#include <stack>
+#include "traversal_control.hpp"
+#include "traversal_workspace.hpp"
+#include "visited_set.hpp"
+#include "../utils/instrumentation.hpp"
 #include <ranges>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -27,35 +30,138 @@ namespace graph {
      * @{
      */
 
+    namespace detail {
+        /**
+         * @brief Explicit-stack DFS engine shared by the public DFS entry points.
+         *
+         * Each frame resumes its node's neighbor range where it left off, so nodes are
+         * entered and left in exactly the order of the recursive formulation while the
+         * stack lives on the heap. No neighbor range is copied.
+         *
+         * @param graph The graph to traverse.
+         * @param start The starting node; nothing happens if it is already visited.
+         * @param visited Visited set shared across calls (e.g. by dfs_complete).
+         * @param stack Scratch vector of DfsFrame, empty on entry and on normal return.
+         * @param pre_visit Called when a node is first reached (preorder); may return a
+         *        TraversalControl. A skipped node is left (post_visit) right away.
+         * @param post_visit Called once all of a node's descendants are done (postorder).
+         * @param instrumentation Told about visited nodes, examined edges, stack depth and
+         *        stack growth.
+         * @return False if the traversal was stopped early, true if it ran to completion.
+         */
+        template<typename GraphType, typename VisitedSet, typename Stack, typename PreFunc, typename PostFunc,
+                 typename Instr = utils::NoInstrumentation>
+        bool dfs_from(const GraphType& graph, typename GraphType::NodeType start, VisitedSet& visited,
+                      Stack& stack, PreFunc& pre_visit, PostFunc& post_visit,
+                      Instr&& instrumentation = Instr{}) {
+            using NodeType = typename GraphType::NodeType;
+            constexpr bool instrumented = std::remove_cvref_t<Instr>::enabled;
+
+            const auto push = [&](const NodeType& node) {
+                if constexpr (instrumented) {
+                    if (stack.size() == stack.capacity()) instrumentation.count_allocations(1);
+                }
+                stack.emplace_back(node, graph.get_neighbors(node));
+                instrumentation.record_frontier(stack.size());
+            };
+
+            if (!visited.insert(start)) return true;
+            const auto start_control = invoke_visit(pre_visit, start);
+            instrumentation.count_nodes(1);
+            if (start_control == TraversalControl::Stop) return false;
+            if (start_control == TraversalControl::SkipChildren) {
+                post_visit(start);
+                return true;
+            }
+            push(start);
+
+            while (!stack.empty()) {
+                auto& frame = stack.back();
+                if (frame.cursor.has_next()) {
+                    NodeType neighbor = frame.cursor.next();
+                    instrumentation.count_edges(1);
+                    if (visited.insert(neighbor)) {
+                        const auto control = invoke_visit(pre_visit, neighbor);
+                        instrumentation.count_nodes(1);
+                        if (control == TraversalControl::Stop) {
+                            stack.clear();
+                            return false;
+                        }
+                        if (control == TraversalControl::SkipChildren) {
+                            post_visit(neighbor);
+                            continue;
+                        }
+                        push(neighbor);
+                    }
+                } else {
+                    NodeType node = std::move(frame.node);
+                    stack.pop_back();
+                    post_visit(node);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Visit callback that does nothing.
+         */
+        struct NoVisit {
+            template<typename NodeType>
+            constexpr void operator()(const NodeType&) const noexcept {}
+        };
+    }
+
     /**
      * @brief Performs depth-first search starting from a given node.
      * @tparam GraphType Graph type satisfying the Graph concept.
      * @tparam VisitFunc Callable type for node visitation.
      * @param graph The graph to traverse.
      * @param start The starting node.
-     * @param visit Function called for each visited node.
+     * @param visit Function called for each visited node. It may return a TraversalControl:
+     *        SkipChildren does not descend below the node and Stop ends the search.
+     * 
+     * Visits nodes in the preorder of the recursive formulation. The recursion is
+     * emulated with an explicit stack, so arbitrarily deep graphs do not overflow
+     * the call stack.
      * 
      * Time Complexity: O(V + E) where V is reachable vertices, E is reachable edges.
-     * Space Complexity: O(V) for visited set + O(h) for recursion depth.
+     * Space Complexity: O(V) for visited set + O(h) stack frames for depth h.
      * 
      * @ingroup dfs
      */
     template<Graph GraphType, typename VisitFunc>
     void dfs_recursive(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit) {
-        std::unordered_set<typename GraphType::NodeType> visited;
-        
-        std::function<void(typename GraphType::NodeType)> dfs_impl = [&](typename GraphType::NodeType node) {
-            if (visited.contains(node)) return;
-            
-            visited.insert(node);
-            visit(node);
-            
-            for (const auto& neighbor : graph.get_neighbors(node)) {
-                dfs_impl(neighbor);
-            }
-        };
-        
-        dfs_impl(start);
+        auto visited = make_visited_set(graph);
+        std::vector<detail::DfsFrame<GraphType>> stack;
+        detail::NoVisit post_visit;
+
+        detail::dfs_from(graph, start, visited, stack, visit, post_visit);
+    }
+
+    /**
+     * @brief Performs depth-first search using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param visit Function called for each visited node.
+     * @param workspace Visited set and stack reused across calls; reset on entry.
+     * 
+     * Same traversal as the overload without a workspace. Once the workspace buffers
+     * have grown to fit the traversal, the call itself performs no allocation.
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename Allocator>
+    void dfs_recursive(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit,
+                       TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        auto& stack = workspace.dfs_stack();
+        stack.clear();
+        detail::NoVisit post_visit;
+
+        detail::dfs_from(graph, start, visited, stack, visit, post_visit);
     }
 
     /**
@@ -66,38 +172,133 @@ namespace graph {
      * @param start The starting node.
      * @param visit Function called for each visited node.
      * 
+     * Each stack frame resumes its node's neighbor range in place, so the order is
+     * the same as dfs_recursive and the neighbors are never copied or reversed.
+     * 
      * Time Complexity: O(V + E) where V is reachable vertices, E is reachable edges.
-     * Space Complexity: O(V) for visited set + stack
+     * Space Complexity: O(V) for visited set + O(h) stack frames for depth h.
      * 
      * @ingroup dfs
      */
     template<Graph GraphType, typename VisitFunc>
     void dfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit) {
-        std::unordered_set<typename GraphType::NodeType> visited;
-        std::stack<typename GraphType::NodeType> stack;
-        
-        stack.push(start);
-        
-        while (!stack.empty()) {
-            auto node = stack.top();
-            stack.pop();
-            
-            if (visited.contains(node)) continue;
-            
-            visited.insert(node);
-            visit(node);
-            
-            // Convert to vector for reverse iteration (consistent traversal order)
-            auto neighbors = graph.get_neighbors(node);
-            std::vector<typename GraphType::NodeType> neighbor_vec(neighbors.begin(), neighbors.end());
-            
-            // Add neighbors in reverse order for consistent left-to-right traversal
-            for (auto it = neighbor_vec.rbegin(); it != neighbor_vec.rend(); ++it) {
-                if (!visited.contains(*it)) {
-                    stack.push(*it);
-                }
-            }
-        }
+        auto visited = make_visited_set(graph);
+        std::vector<detail::DfsFrame<GraphType>> stack;
+        detail::NoVisit post_visit;
+
+        detail::dfs_from(graph, start, visited, stack, visit, post_visit);
+    }
+
+    /**
+     * @brief Performs iterative depth-first search using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param visit Function called for each visited node.
+     * @param workspace Visited set and stack reused across calls; reset on entry.
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename Allocator>
+    void dfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit,
+                       TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        auto& stack = workspace.dfs_stack();
+        stack.clear();
+        detail::NoVisit post_visit;
+
+        detail::dfs_from(graph, start, visited, stack, visit, post_visit);
+    }
+
+    /**
+     * @brief Performs iterative depth-first search and reports its operation counts.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Instr Type satisfying utils::Instrumentation.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param visit Function called for each visited node; may return a TraversalControl.
+     * @param instrumentation Receives the counts of this call.
+     * 
+     * Same traversal as the plain overload. Every node handed to visit and every
+     * neighbor read is counted, the deepest stack is recorded as the frontier peak,
+     * and growing the stack counts as an allocation. finish("dfs_iterative") is called
+     * when the traversal ends, including after Stop. With utils::NoInstrumentation
+     * this compiles to the plain overload.
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename VisitFunc, utils::Instrumentation Instr>
+    void dfs_iterative(const GraphType& graph, typename GraphType::NodeType start, VisitFunc visit,
+                       Instr& instrumentation) {
+        auto visited = make_visited_set(graph);
+        std::vector<detail::DfsFrame<GraphType>> stack;
+        detail::NoVisit post_visit;
+
+        detail::dfs_from(graph, start, visited, stack, visit, post_visit, instrumentation);
+        instrumentation.finish("dfs_iterative");
+    }
+
+    /**
+     * @brief Performs depth-first search with both preorder and postorder hooks.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam PreFunc Callable type invoked when a node is entered.
+     * @tparam PostFunc Callable type invoked when a node is left.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param pre_visit Function called when a node is first reached; may return a TraversalControl.
+     * @param post_visit Function called after every node reachable through it has been left.
+     * 
+     * Equivalent to the recursive traversal that calls `pre_visit` before recursing into
+     * the neighbors and `post_visit` after, e.g. to compute finishing times or a
+     * reverse topological order. A node skipped with SkipChildren is left immediately;
+     * after Stop no further hook is called, not even post_visit for the open nodes.
+     * 
+     * Time Complexity: O(V + E) where V is reachable vertices, E is reachable edges.
+     * Space Complexity: O(V) for visited set + O(h) stack frames for depth h.
+     * 
+     * @par Example:
+     * ```cpp
+     * std::vector<int> finished;
+     * algorithms::graph::dfs_pre_post_order(graph, 0, [](int) {},
+     *     [&finished](int node) { finished.push_back(node); });
+     * ```
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename PreFunc, typename PostFunc>
+    void dfs_pre_post_order(const GraphType& graph, typename GraphType::NodeType start,
+                            PreFunc pre_visit, PostFunc post_visit) {
+        auto visited = make_visited_set(graph);
+        std::vector<detail::DfsFrame<GraphType>> stack;
+
+        detail::dfs_from(graph, start, visited, stack, pre_visit, post_visit);
+    }
+
+    /**
+     * @brief Performs depth-first search with pre/postorder hooks using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam PreFunc Callable type invoked when a node is entered.
+     * @tparam PostFunc Callable type invoked when a node is left.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param start The starting node.
+     * @param pre_visit Function called when a node is first reached.
+     * @param post_visit Function called after every node reachable through it has been left.
+     * @param workspace Visited set and stack reused across calls; reset on entry.
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename PreFunc, typename PostFunc, typename Allocator>
+    void dfs_pre_post_order(const GraphType& graph, typename GraphType::NodeType start,
+                            PreFunc pre_visit, PostFunc post_visit, TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        auto& stack = workspace.dfs_stack();
+        stack.clear();
+
+        detail::dfs_from(graph, start, visited, stack, pre_visit, post_visit);
     }
 
     /**
@@ -108,29 +309,44 @@ namespace graph {
      * @param visit Function called for each visited node.
      * 
      * Time Complexity: O(V + E) where V is all vertices, E is all edges.
-     * Space Complexity: O(V) for visited set + recursion depth.
+     * Space Complexity: O(V) for visited set + O(h) stack frames for depth h.
      * 
      * @ingroup dfs
      */
     template<Graph GraphType, typename VisitFunc>
     void dfs_complete(const GraphType& graph, VisitFunc visit) {
-        std::unordered_set<typename GraphType::NodeType> visited;
-        
-        // Reuse the same lambda pattern for consistency
-        std::function<void(typename GraphType::NodeType)> dfs_impl = [&](typename GraphType::NodeType node) {
-            if (visited.contains(node)) return;
-            
-            visited.insert(node);
-            visit(node);
-            
-            for (const auto& neighbor : graph.get_neighbors(node)) {
-                dfs_impl(neighbor);
+        auto visited = make_visited_set(graph);
+        std::vector<detail::DfsFrame<GraphType>> stack;
+        detail::NoVisit post_visit;
+
+        for (const auto& node : graph.get_all_nodes()) {
+            if (!visited.contains(node)) {
+                if (!detail::dfs_from(graph, node, visited, stack, visit, post_visit)) return;
             }
-        };
-        
+        }
+    }
+
+    /**
+     * @brief Performs DFS on all connected components using caller-owned scratch storage.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @tparam Allocator Allocator type of the workspace.
+     * @param graph The graph to traverse.
+     * @param visit Function called for each visited node.
+     * @param workspace Visited set and stack reused across calls; reset on entry.
+     * 
+     * @ingroup dfs
+     */
+    template<Graph GraphType, typename VisitFunc, typename Allocator>
+    void dfs_complete(const GraphType& graph, VisitFunc visit, TraversalWorkspace<GraphType, Allocator>& workspace) {
+        auto& visited = workspace.reset_visited(graph);
+        auto& stack = workspace.dfs_stack();
+        stack.clear();
+        detail::NoVisit post_visit;
+
         for (const auto& node : graph.get_all_nodes()) {
             if (!visited.contains(node)) {
-                dfs_impl(node);
+                if (!detail::dfs_from(graph, node, visited, stack, visit, post_visit)) return;
             }
         }
     }
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @defgroup shortest_paths Shortest Paths
+     * @brief Single-source shortest paths on weighted graphs
+     * @ingroup graph
+     * @{
+     */
+
+    /**
+     * @brief Result of a single-source shortest-path computation.
+     *
+     * `distance[v]` is the length of a shortest path from the source to v, or
+     * infinity() if v was not reached. `parent[v]` is the node before v on that path;
+     * it is v itself for the source and for unreached nodes.
+     */
+    template<typename NodeType, typename WeightType>
+    struct ShortestPaths {
+        std::vector<WeightType> distance;
+        std::vector<NodeType> parent;
+
+        /**
+         * @brief Distance of unreached nodes: +infinity for floating point, the maximum otherwise.
+         */
+        static constexpr WeightType infinity() noexcept {
+            if constexpr (std::numeric_limits<WeightType>::has_infinity) {
+                return std::numeric_limits<WeightType>::infinity();
+            } else {
+                return std::numeric_limits<WeightType>::max();
+            }
+        }
+
+        bool reached(NodeType node) const {
+            return distance[static_cast<std::size_t>(node)] != infinity();
+        }
+
+        /**
+         * @brief Returns the nodes of the shortest path from the source to target, both included.
+         * @return The path, or an empty vector if target was not reached.
+         */
+        std::vector<NodeType> path_to(NodeType target) const {
+            std::vector<NodeType> path;
+            if (!reached(target)) return path;
+            for (NodeType node = target;; node = parent[static_cast<std::size_t>(node)]) {
+                path.push_back(node);
+                if (parent[static_cast<std::size_t>(node)] == node) break;
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+    };
+
+    namespace detail {
+        /**
+         * @brief Children per node of the Dijkstra heap.
+         *
+         * A 4-ary heap is half as deep as a binary one, and the four children of a node
+         * share one cache line, so sift-down costs fewer misses for the same compares.
+         */
+        inline constexpr std::size_t heap_arity = 4;
+
+        /**
+         * @brief Indexed d-ary min-heap of dense ids with decrease-key.
+         *
+         * Entries store their key next to their id, so sifting never touches the
+         * caller's distance array; `position_` maps each id to its heap slot.
+         */
+        template<typename Key>
+        class IndexedDaryHeap {
+        public:
+            explicit IndexedDaryHeap(std::size_t capacity) : position_(capacity, npos) {}
+
+            bool empty() const noexcept { return heap_.empty(); }
+
+            /**
+             * @brief Inserts id with key, or lowers its key if already present.
+             * @pre key is not greater than the current key of id
+             */
+            void push_or_decrease(std::size_t id, Key key) {
+                std::size_t slot = position_[id];
+                if (slot == npos) {
+                    slot = heap_.size();
+                    heap_.push_back({key, id});
+                } else {
+                    heap_[slot].key = key;
+                }
+                sift_up(slot);
+            }
+
+            /**
+             * @brief Removes and returns the (key, id) entry with the smallest key.
+             * @pre !empty()
+             */
+            std::pair<Key, std::size_t> pop() {
+                const Entry top = heap_.front();
+                position_[top.id] = npos;
+                const Entry last = heap_.back();
+                heap_.pop_back();
+                if (!heap_.empty()) {
+                    heap_.front() = last;
+                    sift_down(0);
+                }
+                return {top.key, top.id};
+            }
+
+        private:
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            struct Entry {
+                Key key;
+                std::size_t id;
+            };
+
+            void sift_up(std::size_t slot) {
+                const Entry entry = heap_[slot];
+                while (slot > 0) {
+                    const std::size_t parent = (slot - 1) / heap_arity;
+                    if (!(entry.key < heap_[parent].key)) break;
+                    place(slot, heap_[parent]);
+                    slot = parent;
+                }
+                place(slot, entry);
+            }
+
+            void sift_down(std::size_t slot) {
+                const Entry entry = heap_[slot];
+                const std::size_t size = heap_.size();
+                while (true) {
+                    const std::size_t first_child = slot * heap_arity + 1;
+                    if (first_child >= size) break;
+                    const std::size_t last_child = std::min(first_child + heap_arity, size);
+                    std::size_t best = first_child;
+                    for (std::size_t child = first_child + 1; child < last_child; ++child) {
+                        if (heap_[child].key < heap_[best].key) best = child;
+                    }
+                    if (!(heap_[best].key < entry.key)) break;
+                    place(slot, heap_[best]);
+                    slot = best;
+                }
+                place(slot, entry);
+            }
+
+            void place(std::size_t slot, const Entry& entry) {
+                heap_[slot] = entry;
+                position_[entry.id] = slot;
+            }
+
+            std::vector<Entry> heap_;
+            std::vector<std::size_t> position_;
+        };
+
+        template<typename GraphType>
+        void check_source(const GraphType& graph, typename GraphType::NodeType source) {
+            if constexpr (std::is_signed_v<typename GraphType::NodeType>) {
+                if (source < 0) throw std::out_of_range("source must be a node of the graph");
+            }
+            if (static_cast<std::size_t>(source) >= static_cast<std::size_t>(graph.node_count())) {
+                throw std::out_of_range("source must be a node of the graph");
+            }
+        }
+
+        template<typename WeightType>
+        void check_weight(WeightType weight) {
+            if constexpr (std::is_floating_point_v<WeightType>) {
+                // NaN compares false against everything, and an infinite weight would equal infinity()
+                if (!std::isfinite(weight)) throw std::invalid_argument("edge weights must be finite");
+            }
+            if constexpr (std::is_signed_v<WeightType>) {
+                if (weight < 0) throw std::invalid_argument("edge weights must be non-negative");
+            }
+        }
+
+        /**
+         * @brief distance + weight, or infinity() for integers if the sum would exceed it.
+         * @pre distance and weight are non-negative
+         */
+        template<typename WeightType>
+        WeightType path_length(WeightType distance, WeightType weight) noexcept {
+            if constexpr (std::is_integral_v<WeightType>) {
+                if (weight > std::numeric_limits<WeightType>::max() - distance) {
+                    return std::numeric_limits<WeightType>::max();
+                }
+            }
+            return distance + weight;
+        }
+
+        /**
+         * @brief Dijkstra engine; stops once target is settled, if given.
+         */
+        template<typename GraphType>
+        ShortestPaths<typename GraphType::NodeType, typename GraphType::WeightType>
+        dijkstra(const GraphType& graph, typename GraphType::NodeType source,
+                 std::optional<typename GraphType::NodeType> target) {
+            using NodeType = typename GraphType::NodeType;
+            using WeightType = typename GraphType::WeightType;
+            using Result = ShortestPaths<NodeType, WeightType>;
+
+            check_source(graph, source);
+            const auto node_count = static_cast<std::size_t>(graph.node_count());
+
+            Result result;
+            result.distance.assign(node_count, Result::infinity());
+            result.parent.resize(node_count);
+            for (std::size_t i = 0; i < node_count; ++i) result.parent[i] = static_cast<NodeType>(i);
+
+            IndexedDaryHeap<WeightType> heap(node_count);
+            result.distance[static_cast<std::size_t>(source)] = WeightType{0};
+            heap.push_or_decrease(static_cast<std::size_t>(source), WeightType{0});
+
+            while (!heap.empty()) {
+                const auto [distance, id] = heap.pop();
+                const auto node = static_cast<NodeType>(id);
+                if (target && node == *target) break;
+
+                for (auto&& edge : graph.get_weighted_neighbors(node)) {
+                    const auto neighbor = static_cast<NodeType>(std::get<0>(edge));
+                    const auto weight = static_cast<WeightType>(std::get<1>(edge));
+                    check_weight(weight);
+
+                    const auto index = static_cast<std::size_t>(neighbor);
+                    const WeightType candidate = path_length(distance, weight);
+                    if (candidate < result.distance[index]) {
+                        result.distance[index] = candidate;
+                        result.parent[index] = node;
+                        heap.push_or_decrease(index, candidate);
+                    }
+                }
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief Computes shortest paths from a source to every node with Dijkstra's algorithm.
+     *
+     * Nodes are settled in order of distance using an indexed 4-ary heap with
+     * decrease-key, so the heap never holds more than one entry per node.
+     *
+     * @tparam GraphType Type satisfying both IndexedGraph and WeightedGraph
+     *
+     * @param graph The graph; every edge weight must be non-negative
+     * @param source The node to measure distances from
+     * @return Distances and shortest-path tree parents of all nodes; a node whose
+     *         distance exceeds the largest WeightType value is left unreached
+     * @throws std::out_of_range If source is not a node of the graph
+     * @throws std::invalid_argument If a negative or non-finite edge weight is encountered
+     *
+     * @par Complexity:
+     * - Time: O((V + E) log V)
+     * - Space: O(V)
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::graph::WeightedCsrGraph<> roads(node_count, road_segments);
+     * auto paths = algorithms::graph::dijkstra(roads, depot);
+     * if (paths.reached(customer)) route = paths.path_to(customer);
+     * ```
+     *
+     * @ingroup shortest_paths
+     */
+    template<typename GraphType>
+        requires IndexedGraph<GraphType> && WeightedGraph<GraphType>
+    ShortestPaths<typename GraphType::NodeType, typename GraphType::WeightType>
+    dijkstra(const GraphType& graph, typename GraphType::NodeType source) {
+        return detail::dijkstra(graph, source, std::nullopt);
+    }
+
+    /**
+     * @brief Computes a shortest path from source to target, stopping as soon as target is settled.
+     *
+     * Only nodes closer to the source than target are guaranteed to have final
+     * distances; the distance and path of target itself are exact.
+     *
+     * @param graph The graph; every edge weight must be non-negative
+     * @param source The node to measure distances from
+     * @param target The node whose shortest path is wanted
+     * @return Distances and parents; use `reached(target)` and `path_to(target)`
+     * @throws std::out_of_range If source is not a node of the graph
+     * @throws std::invalid_argument If a negative or non-finite edge weight is encountered
+     *
+     * @ingroup shortest_paths
+     */
+    template<typename GraphType>
+        requires IndexedGraph<GraphType> && WeightedGraph<GraphType>
+    ShortestPaths<typename GraphType::NodeType, typename GraphType::WeightType>
+    dijkstra(const GraphType& graph, typename GraphType::NodeType source, typename GraphType::NodeType target) {
+        return detail::dijkstra(graph, source, std::optional<typename GraphType::NodeType>(target));
+    }
+
+    /** @} */ // end of shortest_paths group
+
+} // namespace graph
+} // namespace algorithms
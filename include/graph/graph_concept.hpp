@@ -1,5 +1,11 @@
+#pragma once
+
 #include <concepts>
+#include <cstddef>
 #include <functional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
 
 namespace algorithms {
 namespace graph {    
@@ -14,6 +20,9 @@ namespace graph {
      *
      * The NodeType must be regular (copyable, assignable, equality comparable) for use in hash sets.
      *
+     * Any range works, including owning containers returned by value, but every call
+     * then builds a container; see ViewGraph for the zero-copy tier.
+     *
      * @code{.cpp}
      * struct AdjacencyListGraph {
      *     using NodeType = int;
@@ -32,7 +41,117 @@ namespace graph {
         requires std::regular<typename GraphType::NodeType>;
     };
 
+    /**
+     * @concept IndexedGraph
+     * @brief Graph whose nodes are dense integral indices in `[0, node_count())`.
+     *
+     * In addition to the Graph requirements, an indexed graph must provide:
+     * - An integral `NodeType`
+     * - `auto node_count() const -> std::size_t` - Number of nodes; every node id
+     *   returned by `get_neighbors` or `get_all_nodes` must be smaller than it
+     *
+     * Traversals detect this refinement at compile time and keep their visited state
+     * in a flat bitset indexed by node id instead of a hash set.
+     *
+     * @code{.cpp}
+     * struct DenseGraph {
+     *     using NodeType = int;
+     *     std::vector<int> get_neighbors(int node) const;
+     *     std::vector<int> get_all_nodes() const;
+     *     std::size_t node_count() const;
+     * };
+     * @endcode
+     *
+     * @ingroup graph
+     */
+    template<typename GraphType>
+    concept IndexedGraph = Graph<GraphType> &&
+        std::integral<typename GraphType::NodeType> &&
+        requires(const GraphType& graph) {
+            { graph.node_count() } -> std::convertible_to<std::size_t>;
+        };
+
+    /**
+     * @concept ViewGraph
+     * @brief Graph whose neighbor ranges are views or borrowed ranges, i.e. cheap handles to existing storage.
+     *
+     * In addition to the Graph requirements, `get_neighbors` must return either an
+     * lvalue reference to a stored container, a borrowed range such as std::span, or
+     * a std::ranges::view such as a `std::views::transform` over an edge block or an
+     * input-only generator view. Traversals hold such a range by value in their stack
+     * frames, so no neighbor list is ever built or copied.
+     *
+     * @code{.cpp}
+     * struct MappedEdgeStore {
+     *     using NodeType = std::uint32_t;
+     *     std::span<const std::uint32_t> get_neighbors(std::uint32_t node) const;
+     *     std::ranges::iota_view<std::uint32_t, std::uint32_t> get_all_nodes() const;
+     * };
+     * @endcode
+     *
+     * @ingroup graph
+     */
+    template<typename GraphType>
+    concept ViewGraph = Graph<GraphType> &&
+        requires(const GraphType& graph, typename GraphType::NodeType node) {
+            requires std::ranges::borrowed_range<decltype(graph.get_neighbors(node))> ||
+                     std::ranges::view<std::remove_cvref_t<decltype(graph.get_neighbors(node))>>;
+        };
+
+    /**
+     * @concept ReversibleViewGraph
+     * @brief ViewGraph whose neighbor ranges can also be walked backwards.
+     *
+     * The neighbor range must be a std::ranges::bidirectional_range, so
+     * `std::views::reverse` applies to it without materializing anything. See
+     * ReversedNeighbors.
+     *
+     * @ingroup graph
+     */
+    template<typename GraphType>
+    concept ReversibleViewGraph = ViewGraph<GraphType> &&
+        requires(const GraphType& graph, typename GraphType::NodeType node) {
+            requires std::ranges::bidirectional_range<decltype(graph.get_neighbors(node))>;
+        };
+
+    /**
+     * @concept WeightedGraph
+     * @brief Graph whose edges carry a weight.
+     *
+     * In addition to the Graph requirements, a weighted graph must provide:
+     * - `using WeightType = weight_type;` - Arithmetic type of edge weights
+     * - `auto get_weighted_neighbors(NodeType node) const -> range` - Returns the
+     *   out-edges of a node as tuple-like `(neighbor, weight)` elements, e.g.
+     *   `std::pair<NodeType, WeightType>`
+     *
+     * `get_neighbors` keeps returning plain nodes, so unweighted traversals work
+     * unchanged on weighted graphs.
+     *
+     * @code{.cpp}
+     * struct RoadNetwork {
+     *     using NodeType = int;
+     *     using WeightType = double;
+     *     std::vector<int> get_neighbors(int node) const;
+     *     std::vector<std::pair<int, double>> get_weighted_neighbors(int node) const;
+     *     std::vector<int> get_all_nodes() const;
+     * };
+     * @endcode
+     *
+     * @ingroup graph
+     */
+    template<typename GraphType>
+    concept WeightedGraph = Graph<GraphType> &&
+        requires(const GraphType& graph, typename GraphType::NodeType node) {
+            typename GraphType::WeightType;
+            requires std::is_arithmetic_v<typename GraphType::WeightType>;
+            { graph.get_weighted_neighbors(node) } -> std::ranges::range;
+            requires requires(std::ranges::range_reference_t<decltype(graph.get_weighted_neighbors(node))> edge) {
+                { std::get<0>(edge) } -> std::convertible_to<typename GraphType::NodeType>;
+                { std::get<1>(edge) } -> std::convertible_to<typename GraphType::WeightType>;
+            };
+        };
+
     /** @} */ // end of graph group
 
 } // namespace graph
-} // namespace algorithms
\ No newline at end of file
+} // namespace algorithms
@@ -0,0 +1,511 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include "../utils/mapped_file.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    /**
+     * @brief Fixed 64-byte header at the start of a CSR graph file.
+     *
+     * File layout, all integers in the byte order of the writing machine:
+     * - the header
+     * - at `offsets_position`: `node_count + 1` std::uint64_t row offsets
+     * - at `targets_position`: `targets_bytes` bytes of neighbor data
+     *
+     * Both sections start on a 64-byte boundary. Without compression the targets are
+     * `edge_count` node ids of `id_bytes` bytes each and offsets index them, exactly
+     * as in CsrGraph. With CsrFileHeader::varint_delta, offsets are byte positions in
+     * the targets section; each node's list is its degree followed by the zigzag
+     * differences between consecutive neighbors (the first taken from the node's own
+     * id), all LEB128 varints.
+     *
+     * @ingroup graph
+     */
+    struct CsrFileHeader {
+        static constexpr char expected_magic[8] = {'A', 'L', 'G', 'O', 'C', 'S', 'R', '\0'};
+        static constexpr std::uint32_t current_version = 1;
+        static constexpr std::uint32_t native_byte_order = 0x01020304;
+        /// Flag bit: targets are varint-delta encoded
+        static constexpr std::uint32_t varint_delta = 1;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint32_t id_bytes;
+        std::uint32_t flags;
+        std::uint64_t node_count;
+        std::uint64_t edge_count;
+        std::uint64_t offsets_position;
+        std::uint64_t targets_position;
+        std::uint64_t targets_bytes;
+    };
+
+    static_assert(sizeof(CsrFileHeader) == 64 && std::is_trivially_copyable_v<CsrFileHeader>);
+
+    /**
+     * @brief Options for write_csr_file.
+     *
+     * @ingroup graph
+     */
+    struct CsrFileOptions {
+        /// Store neighbors as varint deltas; best when neighbor lists are sorted
+        bool compress = false;
+    };
+
+    namespace detail {
+        inline constexpr std::uint64_t csr_section_alignment = 64;
+
+        constexpr std::uint64_t align_section(std::uint64_t position) noexcept {
+            return (position + csr_section_alignment - 1) / csr_section_alignment * csr_section_alignment;
+        }
+
+        constexpr std::uint64_t zigzag_encode(std::int64_t value) noexcept {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        constexpr std::int64_t zigzag_decode(std::uint64_t value) noexcept {
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+
+        inline void append_varint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        /**
+         * @brief Decodes one LEB128 varint and advances data past it.
+         * @pre data points to a complete varint
+         */
+        inline std::uint64_t read_varint(const std::uint8_t*& data) noexcept {
+            std::uint64_t value = 0;
+            for (unsigned shift = 0;; shift += 7) {
+                const std::uint8_t byte = *data++;
+                value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if (byte < 0x80) return value;
+            }
+        }
+
+        struct CsrFileCloser {
+            void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+        };
+
+        inline void write_bytes(std::FILE* file, const void* data, std::size_t size) {
+            if (size != 0 && std::fwrite(data, 1, size, file) != size) {
+                throw std::runtime_error("error writing CSR graph file");
+            }
+        }
+
+        inline void pad_to(std::FILE* file, std::uint64_t& position, std::uint64_t target) {
+            static constexpr char zeros[csr_section_alignment] = {};
+            write_bytes(file, zeros, static_cast<std::size_t>(target - position));
+            position = target;
+        }
+
+        /**
+         * @brief Maps a CSR graph file and checks its header and section bounds in O(1).
+         */
+        class MappedCsrFile {
+        public:
+            MappedCsrFile(const std::filesystem::path& path, std::uint32_t flags, std::uint32_t id_bytes)
+                : file_(path) {
+                const auto bytes = file_.bytes();
+                if (bytes.size() < sizeof(CsrFileHeader)) fail("file is too small");
+                std::memcpy(&header_, bytes.data(), sizeof(CsrFileHeader));
+
+                if (std::memcmp(header_.magic, CsrFileHeader::expected_magic, sizeof(header_.magic)) != 0) {
+                    fail("not a CSR graph file");
+                }
+                if (header_.version != CsrFileHeader::current_version) fail("unsupported version");
+                if (header_.byte_order != CsrFileHeader::native_byte_order) fail("written with a different byte order");
+                if (header_.flags != flags) fail(flags != 0 ? "file is not compressed" : "file is compressed");
+                if (id_bytes != 0 && header_.id_bytes != id_bytes) fail("node id size does not match");
+
+                const std::uint64_t size = bytes.size();
+                const std::uint64_t n = header_.node_count;
+                if (n >= size / sizeof(std::uint64_t) ||
+                    header_.offsets_position % csr_section_alignment != 0 ||
+                    header_.targets_position % csr_section_alignment != 0 ||
+                    header_.offsets_position > size - (n + 1) * sizeof(std::uint64_t) ||
+                    header_.targets_position > size || header_.targets_bytes > size - header_.targets_position) {
+                    fail("sections exceed the file");
+                }
+
+                const auto offsets = this->offsets();
+                if (offsets.front() != 0 || offsets.back() != (flags != 0 ? header_.targets_bytes : header_.edge_count)) {
+                    fail("offsets do not match the targets section");
+                }
+            }
+
+            const CsrFileHeader& header() const noexcept { return header_; }
+
+            std::span<const std::uint64_t> offsets() const noexcept {
+                return {reinterpret_cast<const std::uint64_t*>(file_.bytes().data() + header_.offsets_position),
+                        static_cast<std::size_t>(header_.node_count + 1)};
+            }
+
+            const std::byte* targets() const noexcept {
+                return file_.bytes().data() + header_.targets_position;
+            }
+
+            [[noreturn]] static void fail(const char* reason) {
+                throw std::runtime_error(std::string("invalid CSR graph file: ") + reason);
+            }
+
+        private:
+            utils::MappedFile file_;
+            CsrFileHeader header_{};
+        };
+    }
+
+    /**
+     * @brief Writes a dense-index graph to a CSR graph file.
+     *
+     * Neighbors are written in get_neighbors order. The file can be opened with
+     * MappedCsrGraph, or with MappedCompressedCsrGraph if options.compress is set.
+     *
+     * @tparam GraphType Type satisfying IndexedGraph
+     *
+     * @param path Destination file, replaced if it exists
+     * @param graph The graph to store
+     * @param options Encoding options
+     * @throws std::runtime_error If the file cannot be written
+     *
+     * @par Complexity:
+     * - Time: O(V + E)
+     * - Space: O(1) extra without compression, O(E) bytes with it
+     *
+     * @ingroup graph
+     */
+    template<IndexedGraph GraphType>
+    void write_csr_file(const std::filesystem::path& path, const GraphType& graph, CsrFileOptions options = {}) {
+        using NodeType = typename GraphType::NodeType;
+
+        const auto node_count = static_cast<std::uint64_t>(graph.node_count());
+        std::vector<std::uint64_t> offsets(node_count + 1, 0);
+        std::vector<std::uint8_t> encoded;
+        std::uint64_t edge_count = 0;
+        for (std::uint64_t u = 0; u < node_count; ++u) {
+            auto&& neighbors = graph.get_neighbors(static_cast<NodeType>(u));
+            if (options.compress) {
+                std::vector<std::uint64_t> ids;
+                for (const auto& v : neighbors) ids.push_back(static_cast<std::uint64_t>(v));
+                detail::append_varint(encoded, ids.size());
+                std::uint64_t previous = u;
+                for (const auto id : ids) {
+                    detail::append_varint(encoded, detail::zigzag_encode(static_cast<std::int64_t>(id - previous)));
+                    previous = id;
+                }
+                edge_count += ids.size();
+                offsets[u + 1] = encoded.size();
+            } else {
+                edge_count += static_cast<std::uint64_t>(std::ranges::distance(neighbors));
+                offsets[u + 1] = edge_count;
+            }
+        }
+
+        CsrFileHeader header{};
+        std::memcpy(header.magic, CsrFileHeader::expected_magic, sizeof(header.magic));
+        header.version = CsrFileHeader::current_version;
+        header.byte_order = CsrFileHeader::native_byte_order;
+        header.id_bytes = sizeof(NodeType);
+        header.flags = options.compress ? CsrFileHeader::varint_delta : 0;
+        header.node_count = node_count;
+        header.edge_count = edge_count;
+        header.offsets_position = detail::align_section(sizeof(CsrFileHeader));
+        header.targets_position = detail::align_section(header.offsets_position + (node_count + 1) * sizeof(std::uint64_t));
+        header.targets_bytes = options.compress ? encoded.size() : edge_count * sizeof(NodeType);
+
+        std::unique_ptr<std::FILE, detail::CsrFileCloser> file(std::fopen(path.string().c_str(), "wb"));
+        if (!file) throw std::runtime_error("cannot open file: " + path.string());
+
+        std::uint64_t position = sizeof(CsrFileHeader);
+        detail::write_bytes(file.get(), &header, sizeof(header));
+        detail::pad_to(file.get(), position, header.offsets_position);
+        detail::write_bytes(file.get(), offsets.data(), offsets.size() * sizeof(std::uint64_t));
+        position += offsets.size() * sizeof(std::uint64_t);
+        detail::pad_to(file.get(), position, header.targets_position);
+
+        if (options.compress) {
+            detail::write_bytes(file.get(), encoded.data(), encoded.size());
+        } else {
+            std::vector<NodeType> buffer;
+            for (std::uint64_t u = 0; u < node_count; ++u) {
+                for (const auto& v : graph.get_neighbors(static_cast<NodeType>(u))) {
+                    buffer.push_back(static_cast<NodeType>(v));
+                }
+                if (buffer.size() >= 4096 || u + 1 == node_count) {
+                    detail::write_bytes(file.get(), buffer.data(), buffer.size() * sizeof(NodeType));
+                    buffer.clear();
+                }
+            }
+        }
+
+        if (std::fclose(file.release()) != 0) throw std::runtime_error("error writing CSR graph file");
+    }
+
+    /**
+     * @brief Read-only CSR graph served directly from a memory-mapped file.
+     *
+     * Opening maps the file and checks its header in O(1); nothing is parsed or
+     * copied, and neighbor lists are spans into the mapping, so startup cost does
+     * not depend on the graph size and processes mapping the same file share its
+     * pages. The accessors mirror CsrGraph, and the class satisfies IndexedGraph and
+     * ReversibleViewGraph.
+     *
+     * @tparam NodeT Integral node id type; must have the size the file was written with
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::graph::write_csr_file("roads.csr", graph);  // once, offline
+     * algorithms::graph::MappedCsrGraph<> roads("roads.csr");  // at every start
+     * algorithms::graph::bfs_iterative(roads, 0, visit);
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<std::integral NodeT = std::uint32_t>
+    class MappedCsrGraph {
+    public:
+        using NodeType = NodeT;
+
+        /**
+         * @brief Maps an uncompressed CSR graph file.
+         * @throws std::runtime_error If the file cannot be mapped, is compressed, was
+         *   written with another node id size or byte order, or has inconsistent sections
+         */
+        explicit MappedCsrGraph(const std::filesystem::path& path) : file_(path, 0, sizeof(NodeType)) {
+            if (file_.header().node_count > static_cast<std::uint64_t>(std::numeric_limits<NodeType>::max())) {
+                detail::MappedCsrFile::fail("node count does not fit the node id type");
+            }
+            // Divided rather than multiplied: a huge edge_count would wrap the product
+            if (file_.header().edge_count > file_.header().targets_bytes / sizeof(NodeType) ||
+                file_.header().targets_bytes != file_.header().edge_count * sizeof(NodeType)) {
+                detail::MappedCsrFile::fail("targets section has the wrong size");
+            }
+        }
+
+        std::span<const NodeType> get_neighbors(NodeType node) const {
+            const auto offsets = file_.offsets();
+            const auto index = static_cast<std::size_t>(node);
+            return std::span<const NodeType>(targets_data() + offsets[index],
+                                             static_cast<std::size_t>(offsets[index + 1] - offsets[index]));
+        }
+
+        std::ranges::iota_view<NodeType, NodeType> get_all_nodes() const {
+            return std::views::iota(NodeType{0}, static_cast<NodeType>(node_count()));
+        }
+
+        std::size_t node_count() const noexcept { return static_cast<std::size_t>(file_.header().node_count); }
+
+        std::size_t edge_count() const noexcept { return static_cast<std::size_t>(file_.header().edge_count); }
+
+        std::size_t degree(NodeType node) const {
+            const auto offsets = file_.offsets();
+            const auto index = static_cast<std::size_t>(node);
+            return static_cast<std::size_t>(offsets[index + 1] - offsets[index]);
+        }
+
+        /**
+         * @brief Returns the row offsets array (size `node_count() + 1`).
+         */
+        std::span<const std::uint64_t> offsets() const noexcept { return file_.offsets(); }
+
+        /**
+         * @brief Returns the concatenated neighbor lists (size `edge_count()`).
+         */
+        std::span<const NodeType> targets() const noexcept { return {targets_data(), edge_count()}; }
+
+        /**
+         * @brief Checks every offset and target, which opening does not do.
+         *
+         * Runs in O(V + E) and touches every page; call it once after receiving a file
+         * from an untrusted source.
+         *
+         * @throws std::runtime_error If offsets decrease or exceed the edge count, or a
+         *   target is not a valid node id
+         */
+        void validate() const {
+            const auto offsets = file_.offsets();
+            for (std::size_t i = 1; i < offsets.size(); ++i) {
+                if (offsets[i] < offsets[i - 1]) detail::MappedCsrFile::fail("offsets must be non-decreasing");
+            }
+            for (const auto offset : offsets) {
+                if (offset > file_.header().edge_count) detail::MappedCsrFile::fail("offset past the targets section");
+            }
+            for (const auto& target : targets()) {
+                if constexpr (std::is_signed_v<NodeType>) {
+                    if (target < 0) detail::MappedCsrFile::fail("target out of range");
+                }
+                if (static_cast<std::size_t>(target) >= node_count()) detail::MappedCsrFile::fail("target out of range");
+            }
+        }
+
+    private:
+        const NodeType* targets_data() const noexcept {
+            return reinterpret_cast<const NodeType*>(file_.targets());
+        }
+
+        detail::MappedCsrFile file_;
+    };
+
+    /**
+     * @brief Lazy view decoding one node's varint-delta neighbor list.
+     *
+     * A forward view holding two pointers' worth of state; it is borrowed, since its
+     * iterators point into the mapped file rather than into the view.
+     *
+     * @ingroup graph
+     */
+    template<std::integral NodeT>
+    class VarintNeighborView : public std::ranges::view_interface<VarintNeighborView<NodeT>> {
+    public:
+        class iterator {
+        public:
+            using value_type = NodeT;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            iterator(const std::uint8_t* data, std::uint64_t remaining, std::uint64_t previous)
+                : data_(data), remaining_(remaining), current_(previous) {
+                advance();
+            }
+
+            NodeT operator*() const noexcept { return static_cast<NodeT>(current_); }
+
+            iterator& operator++() noexcept {
+                --remaining_;
+                advance();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept {
+                iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            bool operator==(const iterator& other) const noexcept {
+                return remaining_ == other.remaining_ && (remaining_ == 0 || data_ == other.data_);
+            }
+
+            bool operator==(std::default_sentinel_t) const noexcept { return remaining_ == 0; }
+
+        private:
+            void advance() noexcept {
+                if (remaining_ != 0) {
+                    current_ += static_cast<std::uint64_t>(detail::zigzag_decode(detail::read_varint(data_)));
+                }
+            }
+
+            const std::uint8_t* data_ = nullptr;
+            std::uint64_t remaining_ = 0;
+            std::uint64_t current_ = 0;
+        };
+
+        VarintNeighborView() = default;
+
+        VarintNeighborView(const std::uint8_t* data, std::uint64_t node) : node_(node) {
+            degree_ = detail::read_varint(data);
+            data_ = data;
+        }
+
+        iterator begin() const noexcept { return iterator(data_, degree_, node_); }
+
+        std::default_sentinel_t end() const noexcept { return {}; }
+
+        std::size_t size() const noexcept { return static_cast<std::size_t>(degree_); }
+
+    private:
+        const std::uint8_t* data_ = nullptr;
+        std::uint64_t degree_ = 0;
+        std::uint64_t node_ = 0;
+    };
+
+    /**
+     * @brief Read-only CSR graph served from a memory-mapped varint-delta compressed file.
+     *
+     * Same O(1) startup and page sharing as MappedCsrGraph. Neighbor lists are
+     * decoded on the fly by VarintNeighborView, trading a little CPU per edge for a
+     * file typically 2-4x smaller when neighbor lists are sorted and local. The class
+     * satisfies IndexedGraph and ViewGraph.
+     *
+     * Only the header and offsets bounds are checked; the varint stream itself is
+     * trusted, so only open compressed files produced by write_csr_file.
+     *
+     * @tparam NodeT Integral node id type; node ids are decoded into it
+     *
+     * @ingroup graph
+     */
+    template<std::integral NodeT = std::uint32_t>
+    class MappedCompressedCsrGraph {
+    public:
+        using NodeType = NodeT;
+
+        /**
+         * @brief Maps a compressed CSR graph file.
+         * @throws std::runtime_error If the file cannot be mapped, is not compressed, or
+         *   has inconsistent sections
+         */
+        explicit MappedCompressedCsrGraph(const std::filesystem::path& path) : file_(path, CsrFileHeader::varint_delta, 0) {
+            if (file_.header().node_count > static_cast<std::uint64_t>(std::numeric_limits<NodeType>::max())) {
+                detail::MappedCsrFile::fail("node count does not fit the node id type");
+            }
+        }
+
+        VarintNeighborView<NodeType> get_neighbors(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            return VarintNeighborView<NodeType>(bytes() + file_.offsets()[index], static_cast<std::uint64_t>(index));
+        }
+
+        std::ranges::iota_view<NodeType, NodeType> get_all_nodes() const {
+            return std::views::iota(NodeType{0}, static_cast<NodeType>(node_count()));
+        }
+
+        std::size_t node_count() const noexcept { return static_cast<std::size_t>(file_.header().node_count); }
+
+        std::size_t edge_count() const noexcept { return static_cast<std::size_t>(file_.header().edge_count); }
+
+        std::size_t degree(NodeType node) const { return get_neighbors(node).size(); }
+
+    private:
+        const std::uint8_t* bytes() const noexcept {
+            return reinterpret_cast<const std::uint8_t*>(file_.targets());
+        }
+
+        detail::MappedCsrFile file_;
+    };
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
+
+template<std::integral NodeT>
+inline constexpr bool std::ranges::enable_borrowed_range<algorithms::graph::VarintNeighborView<NodeT>> = true;
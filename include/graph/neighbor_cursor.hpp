@@ -0,0 +1,159 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief The range type returned by `GraphType::get_neighbors`.
+         */
+        template<typename GraphType>
+        using NeighborRange = decltype(std::declval<const GraphType&>().get_neighbors(
+            std::declval<typename GraphType::NodeType>()));
+
+        /**
+         * @brief How a NeighborCursor keeps its place in a neighbor range.
+         */
+        enum class CursorKind {
+            Borrowed,      ///< Iterators outlive the range object: keep only iterator + sentinel
+            Indexed,       ///< Owning random-access range: keep the range + an index
+            Iterator,      ///< Other owning forward ranges: keep the range + an iterator and count
+            Pinned         ///< Owning input-only range: keep the range on the heap + an iterator
+        };
+
+        template<typename Range>
+        constexpr CursorKind cursor_kind() {
+            if constexpr (std::ranges::borrowed_range<Range>) {
+                return CursorKind::Borrowed;
+            } else if constexpr (std::ranges::random_access_range<Range> && std::ranges::sized_range<Range>) {
+                return CursorKind::Indexed;
+            } else if constexpr (!std::ranges::forward_range<Range>) {
+                return CursorKind::Pinned;
+            } else {
+                return CursorKind::Iterator;
+            }
+        }
+
+        /**
+         * @brief Resumable position inside a node's neighbor range.
+         *
+         * Explicit-stack traversals store one cursor per stack frame and pull one neighbor
+         * at a time, which reproduces the visit order of the recursive formulation without
+         * copying the range. Cursors stay valid when the frame stack reallocates: borrowed
+         * ranges keep no storage, random-access ranges are addressed by index, the
+         * remaining owning forward ranges (e.g. std::list) re-derive their iterator after
+         * a move, and input-only ranges such as generator views, which can be iterated
+         * only once, are kept at a fixed heap address.
+         *
+         * @tparam Range Neighbor range type, as returned by `get_neighbors`.
+         */
+        template<typename Range, CursorKind Kind = cursor_kind<Range>()>
+        class NeighborCursor;
+
+        template<typename Range>
+        class NeighborCursor<Range, CursorKind::Borrowed> {
+        public:
+            explicit NeighborCursor(Range&& range)
+                : it_(std::ranges::begin(range)), end_(std::ranges::end(range)) {}
+
+            bool has_next() const { return it_ != end_; }
+
+            // Copied before advancing: a reference need not survive ++ (borrowed input views, stashing iterators)
+            std::ranges::range_value_t<Range> next() {
+                std::ranges::range_value_t<Range> value = *it_;
+                ++it_;
+                return value;
+            }
+
+        private:
+            std::ranges::iterator_t<Range> it_;
+            std::ranges::sentinel_t<Range> end_;
+        };
+
+        template<typename Range>
+        class NeighborCursor<Range, CursorKind::Indexed> {
+        public:
+            explicit NeighborCursor(Range&& range) : range_(std::move(range)) {}
+
+            bool has_next() { return index_ < static_cast<std::size_t>(std::ranges::size(range_)); }
+
+            decltype(auto) next() { return std::ranges::begin(range_)[index_++]; }
+
+        private:
+            Range range_;
+            std::size_t index_ = 0;
+        };
+
+        template<typename Range>
+        class NeighborCursor<Range, CursorKind::Iterator> {
+        public:
+            explicit NeighborCursor(Range&& range)
+                : range_(std::move(range)), it_(std::ranges::begin(range_)) {}
+
+            // Moving the range may invalidate iterators into it (e.g. std::list's end()),
+            // so the position is re-derived from the number of neighbors consumed.
+            NeighborCursor(NeighborCursor&& other)
+                : range_(std::move(other.range_)),
+                  it_(std::ranges::next(std::ranges::begin(range_), other.consumed_)),
+                  consumed_(other.consumed_) {}
+
+            NeighborCursor& operator=(NeighborCursor&& other) {
+                range_ = std::move(other.range_);
+                it_ = std::ranges::next(std::ranges::begin(range_), other.consumed_);
+                consumed_ = other.consumed_;
+                return *this;
+            }
+
+            bool has_next() { return it_ != std::ranges::end(range_); }
+
+            // Copied before advancing: a forward iterator's reference need not survive ++
+            std::ranges::range_value_t<Range> next() {
+                std::ranges::range_value_t<Range> value = *it_;
+                ++it_;
+                ++consumed_;
+                return value;
+            }
+
+        private:
+            Range range_;
+            std::ranges::iterator_t<Range> it_;
+            std::size_t consumed_ = 0;
+        };
+
+        template<typename Range>
+        class NeighborCursor<Range, CursorKind::Pinned> {
+        public:
+            // The iterator of a single-pass range may point into the range object, and
+            // begin() cannot be called again, so the range never moves once started.
+            explicit NeighborCursor(Range&& range)
+                : range_(std::make_unique<Range>(std::move(range))), it_(std::ranges::begin(*range_)) {}
+
+            bool has_next() { return it_ != std::ranges::end(*range_); }
+
+            // Copied before advancing: *it_ may refer to state inside the range that ++ overwrites
+            std::ranges::range_value_t<Range> next() {
+                std::ranges::range_value_t<Range> value = *it_;
+                ++it_;
+                return value;
+            }
+
+        private:
+            std::unique_ptr<Range> range_;
+            std::ranges::iterator_t<Range> it_;
+        };
+    }
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include "traversal_control.hpp"
+#include "visited_set.hpp"
+#include "../utils/parallel.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup bfs
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Number of frontier nodes claimed at once by a top-down worker.
+         */
+        inline constexpr std::size_t top_down_grain = 64;
+
+        /**
+         * @brief Number of node ids claimed at once by a bottom-up worker.
+         */
+        inline constexpr std::size_t bottom_up_grain = 1024;
+
+        /**
+         * @brief Switch to bottom-up once the frontier's edges exceed 1/alpha of the unexplored edges.
+         */
+        inline constexpr std::size_t direction_alpha = 14;
+
+        /**
+         * @brief Switch back to top-down once the frontier holds fewer than 1/beta of all nodes.
+         */
+        inline constexpr std::size_t direction_beta = 24;
+
+        template<typename GraphType>
+        std::size_t out_degree(const GraphType& graph, typename GraphType::NodeType node) {
+            auto&& neighbors = graph.get_neighbors(node);
+            return static_cast<std::size_t>(std::ranges::distance(neighbors));
+        }
+
+        /**
+         * @brief Level-synchronous parallel BFS engine.
+         *
+         * Each level is expanded by all threads into thread-local buffers that are then
+         * concatenated into the next frontier. With DirectionOptimizing, levels whose
+         * frontier touches a large share of the remaining edges are expanded bottom-up
+         * instead: every unvisited node scans its in-neighbors in `transpose` and stops
+         * at the first one found in the current frontier.
+         *
+         * The visit function is only ever called from the calling thread, and may return
+         * a TraversalControl to skip a node's children or stop the traversal.
+         */
+        template<bool DirectionOptimizing, typename GraphType, typename TransposeType, typename VisitFunc>
+        void parallel_bfs(const utils::ParallelPolicy& policy, const GraphType& graph, const TransposeType& transpose,
+                          typename GraphType::NodeType start, VisitFunc& visit) {
+            using NodeType = typename GraphType::NodeType;
+
+            const std::size_t node_count = static_cast<std::size_t>(graph.node_count());
+            const std::size_t thread_count = policy.resolved_thread_count();
+
+            AtomicBitsetVisitedSet<NodeType> visited(node_count);
+            std::vector<NodeType> frontier;
+            std::vector<std::vector<NodeType>> local_next(thread_count);
+            std::vector<std::size_t> local_edges(thread_count, 0);
+
+            // Only the direction-optimizing variant needs edge counts and a frontier bitmap
+            AtomicBitsetVisitedSet<NodeType> in_frontier(DirectionOptimizing ? node_count : 0);
+            std::size_t unexplored_edges = 0;
+            std::size_t frontier_edges = 0;
+            if constexpr (DirectionOptimizing) {
+                utils::parallel_for_chunks(thread_count, node_count, bottom_up_grain,
+                    [&](std::size_t thread, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            local_edges[thread] += out_degree(graph, static_cast<NodeType>(i));
+                        }
+                    });
+                for (auto& count : local_edges) {
+                    unexplored_edges += count;
+                    count = 0;
+                }
+                frontier_edges = out_degree(graph, start);
+            }
+
+            visited.insert(start);
+            frontier.push_back(start);
+            bool bottom_up = false;
+
+            while (!frontier.empty()) {
+                if constexpr (returns_traversal_control<VisitFunc, NodeType>) {
+                    // Skipped nodes leave the frontier so that no thread expands them
+                    std::size_t kept = 0;
+                    for (std::size_t i = 0; i < frontier.size(); ++i) {
+                        const auto control = visit(frontier[i]);
+                        if (control == TraversalControl::Stop) return;
+                        if (control == TraversalControl::Continue) frontier[kept++] = frontier[i];
+                    }
+                    frontier.resize(kept);
+                } else {
+                    for (const auto& node : frontier) {
+                        visit(node);
+                    }
+                }
+
+                if constexpr (DirectionOptimizing) {
+                    if (!bottom_up && frontier_edges > unexplored_edges / direction_alpha) {
+                        bottom_up = true;
+                    } else if (bottom_up && frontier.size() < node_count / direction_beta) {
+                        bottom_up = false;
+                    }
+                    unexplored_edges -= std::min(unexplored_edges, frontier_edges);
+                }
+
+                if (DirectionOptimizing && bottom_up) {
+                    utils::parallel_for_chunks(thread_count, frontier.size(), top_down_grain,
+                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) in_frontier.insert(frontier[i]);
+                        });
+
+                    utils::parallel_for_chunks(thread_count, node_count, bottom_up_grain,
+                        [&](std::size_t thread, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                const auto node = static_cast<NodeType>(i);
+                                if (visited.contains(node)) continue;
+                                for (const auto& parent : transpose.get_neighbors(node)) {
+                                    if (in_frontier.contains(parent)) {
+                                        visited.insert(node);
+                                        local_next[thread].push_back(node);
+                                        local_edges[thread] += out_degree(graph, node);
+                                        break;
+                                    }
+                                }
+                            }
+                        });
+
+                    utils::parallel_for_chunks(thread_count, frontier.size(), top_down_grain,
+                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) in_frontier.erase(frontier[i]);
+                        });
+                } else {
+                    utils::parallel_for_chunks(thread_count, frontier.size(), top_down_grain,
+                        [&](std::size_t thread, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                for (const auto& neighbor : graph.get_neighbors(frontier[i])) {
+                                    if (visited.insert(neighbor)) {
+                                        local_next[thread].push_back(neighbor);
+                                        if constexpr (DirectionOptimizing) {
+                                            local_edges[thread] += out_degree(graph, neighbor);
+                                        }
+                                    }
+                                }
+                            }
+                        });
+                }
+
+                frontier.clear();
+                frontier_edges = 0;
+                for (std::size_t thread = 0; thread < thread_count; ++thread) {
+                    frontier.insert(frontier.end(), local_next[thread].begin(), local_next[thread].end());
+                    local_next[thread].clear();
+                    frontier_edges += local_edges[thread];
+                    local_edges[thread] = 0;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Performs breadth-first search on several threads.
+     * @tparam GraphType Graph type satisfying the IndexedGraph concept.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @param policy Number of threads to use.
+     * @param graph The graph to traverse; `get_neighbors` must be safe to call concurrently.
+     * @param start The starting node.
+     * @param visit Function called for each visited node.
+     *
+     * Follows the contract of bfs_iterative: every node reachable from start is visited
+     * exactly once, and all nodes at depth d are visited before any node at depth d + 1.
+     * The order of nodes within a level is unspecified. `visit` is always called from
+     * the calling thread, so it does not need to be thread-safe. It may return a
+     * TraversalControl: SkipChildren keeps the node out of the expansion and Stop ends
+     * the search once the current level has been handed to visit up to that node.
+     *
+     * Each level is expanded top-down by all threads, with an atomic bitset as visited set.
+     *
+     * Time Complexity: O(V + E) work, O(D) synchronization rounds where D is the depth.
+     * Space Complexity: O(V) for visited bitset + frontier buffers
+     *
+     * @ingroup bfs
+     */
+    template<IndexedGraph GraphType, typename VisitFunc>
+    void bfs_iterative(const utils::ParallelPolicy& policy, const GraphType& graph,
+                       typename GraphType::NodeType start, VisitFunc visit) {
+        detail::parallel_bfs<false>(policy, graph, graph, start, visit);
+    }
+
+    /**
+     * @brief Performs direction-optimizing breadth-first search on several threads.
+     * @tparam GraphType Graph type satisfying the IndexedGraph concept.
+     * @tparam TransposeType Graph type satisfying the IndexedGraph concept, same NodeType.
+     * @tparam VisitFunc Callable type for node visitation.
+     * @param policy Number of threads to use.
+     * @param graph The graph to traverse; `get_neighbors` must be safe to call concurrently.
+     * @param transpose The graph with every edge reversed. For undirected (symmetric)
+     *        graphs pass `graph` itself.
+     * @param start The starting node.
+     * @param visit Function called for each visited node.
+     *
+     * Same contract as the top-down parallel overload. Levels whose frontier has more
+     * outgoing edges than a fraction of the still unexplored edges are expanded
+     * bottom-up: each unvisited node looks for any parent in the frontier through
+     * `transpose` and stops at the first hit. This skips most edge checks in the
+     * middle levels of low-diameter graphs. The traversal returns to top-down once
+     * the frontier shrinks again.
+     *
+     * Time Complexity: O(V + E) work per level in the worst case, typically far less.
+     * Space Complexity: O(V) for visited and frontier bitsets + frontier buffers
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::graph::CsrGraph<> social(node_count, edges);   // symmetric edge list
+     * algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{32},
+     *                                  social, social, 0, [](std::uint32_t node) { ... });
+     * ```
+     *
+     * @ingroup bfs
+     */
+    template<IndexedGraph GraphType, IndexedGraph TransposeType, typename VisitFunc>
+        requires std::same_as<typename GraphType::NodeType, typename TransposeType::NodeType>
+    void bfs_iterative(const utils::ParallelPolicy& policy, const GraphType& graph, const TransposeType& transpose,
+                       typename GraphType::NodeType start, VisitFunc visit) {
+        detail::parallel_bfs<true>(policy, graph, transpose, start, visit);
+    }
+
+    /** @} */ // end of bfs group
+
+} // namespace graph
+} // namespace algorithms
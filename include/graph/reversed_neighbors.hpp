@@ -0,0 +1,65 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include <cstddef>
+#include <ranges>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    /**
+     * @brief Non-owning graph adapter that presents every neighbor range back to front.
+     *
+     * `get_neighbors` returns `std::views::reverse` of the wrapped graph's range, a
+     * lazy view over the same storage, so nothing is copied. Traversals over the
+     * adapter explore the last neighbor first, e.g. DFS then yields the order of a
+     * classic push-all-neighbors stack DFS over the original graph. The edges
+     * themselves are not reversed; use a transpose graph for that.
+     *
+     * The adapter is itself a ReversibleViewGraph, and an IndexedGraph when the
+     * wrapped graph is one.
+     *
+     * @tparam GraphType Graph satisfying ReversibleViewGraph; it must outlive the adapter
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::graph::CsrGraph<> graph(node_count, edges);
+     * algorithms::graph::ReversedNeighbors reversed(graph);
+     * algorithms::graph::dfs_iterative(reversed, 0, visit);
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<ReversibleViewGraph GraphType>
+    class ReversedNeighbors {
+    public:
+        using NodeType = typename GraphType::NodeType;
+
+        explicit ReversedNeighbors(const GraphType& graph) noexcept : graph_(&graph) {}
+
+        auto get_neighbors(NodeType node) const {
+            return std::views::reverse(graph_->get_neighbors(node));
+        }
+
+        decltype(auto) get_all_nodes() const {
+            return graph_->get_all_nodes();
+        }
+
+        std::size_t node_count() const requires IndexedGraph<GraphType> {
+            return static_cast<std::size_t>(graph_->node_count());
+        }
+
+        const GraphType& base() const noexcept { return *graph_; }
+
+    private:
+        const GraphType* graph_;
+    };
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    /**
+     * @brief Value a traversal visit callback may return to steer the traversal.
+     *
+     * Visit callbacks of BFS and DFS may return either `void` or a TraversalControl;
+     * the traversals detect which at compile time, so `void` callbacks pay nothing.
+     *
+     * @par Example:
+     * ```cpp
+     * // Find the first node in BFS order that matches a predicate
+     * std::optional<int> found;
+     * algorithms::graph::bfs_iterative(graph, 0, [&](int node) {
+     *     if (!matches(node)) return algorithms::graph::TraversalControl::Continue;
+     *     found = node;
+     *     return algorithms::graph::TraversalControl::Stop;
+     * });
+     * ```
+     *
+     * @ingroup graph
+     */
+    enum class TraversalControl {
+        Continue,       ///< Keep going and expand the node's neighbors
+        SkipChildren,   ///< Keep going but do not expand this node's neighbors
+        Stop            ///< End the traversal immediately
+    };
+
+    namespace detail {
+        /**
+         * @brief True if calling Func with a node yields a TraversalControl.
+         */
+        template<typename Func, typename NodeType>
+        inline constexpr bool returns_traversal_control =
+            std::same_as<std::invoke_result_t<Func&, const NodeType&>, TraversalControl>;
+
+        /**
+         * @brief Calls a visit callback and normalizes its result to a TraversalControl.
+         *
+         * `void` callbacks always continue.
+         */
+        template<typename Func, typename NodeType>
+        constexpr TraversalControl invoke_visit(Func& visit, const NodeType& node) {
+            if constexpr (returns_traversal_control<Func, NodeType>) {
+                return visit(node);
+            } else {
+                visit(node);
+                return TraversalControl::Continue;
+            }
+        }
+    }
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
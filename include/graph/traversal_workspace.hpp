@@ -0,0 +1,149 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include "neighbor_cursor.hpp"
+#include "visited_set.hpp"
+#include "../utils/allocator.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief One level of the explicit DFS stack: a node and its place among its neighbors.
+         */
+        template<typename GraphType>
+        struct DfsFrame {
+            typename GraphType::NodeType node;
+            NeighborCursor<NeighborRange<GraphType>> cursor;
+
+            DfsFrame(typename GraphType::NodeType n, NeighborRange<GraphType>&& neighbors)
+                : node(std::move(n)), cursor(std::forward<NeighborRange<GraphType>>(neighbors)) {}
+        };
+
+        template<typename GraphType, typename Allocator, bool Indexed = IndexedGraph<GraphType>>
+        struct WorkspaceVisitedSet {
+            using type = HashVisitedSet<typename GraphType::NodeType, Allocator>;
+        };
+
+        template<typename GraphType, typename Allocator>
+        struct WorkspaceVisitedSet<GraphType, Allocator, true> {
+            using type = EpochVisitedSet<typename GraphType::NodeType, Allocator>;
+        };
+    }
+
+    /**
+     * @brief Reusable scratch storage for BFS and DFS over one graph type.
+     *
+     * Holds the visited set, the two BFS frontier buffers and the DFS frame stack.
+     * Traversal overloads taking a workspace reset it at the start of each call but
+     * keep every buffer's capacity, so once the buffers have grown to the largest
+     * traversal seen, further traversals allocate nothing in the library itself.
+     *
+     * For IndexedGraph types the visited set is an EpochVisitedSet, cleared in O(1)
+     * by bumping its epoch; otherwise it is a HashVisitedSet whose buckets are kept.
+     *
+     * A workspace is not thread-safe: give each thread its own.
+     *
+     * Every buffer is allocated with Allocator, rebound to its element type, so a
+     * workspace can draw from an arena or a hugepage pool instead of the global heap;
+     * see PmrTraversalWorkspace. Neighbor ranges a DFS frame has to pin (input-only
+     * views) still use the global heap.
+     *
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam Allocator Allocator for the visited set, frontiers and stack.
+     *
+     * @par Example:
+     * ```cpp
+     * thread_local algorithms::graph::TraversalWorkspace<algorithms::graph::CsrGraph<>> workspace;
+     * bool found = false;
+     * algorithms::graph::bfs_iterative(graph, source, [&](std::uint32_t node) {
+     *     found = found || node == target;
+     * }, workspace);
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<Graph GraphType, utils::SimpleAllocator Allocator = std::allocator<typename GraphType::NodeType>>
+    class TraversalWorkspace {
+    public:
+        using NodeType = typename GraphType::NodeType;
+        using VisitedSet = typename detail::WorkspaceVisitedSet<GraphType, Allocator>::type;
+        using Frame = detail::DfsFrame<GraphType>;
+        using Frontier = std::vector<NodeType, utils::RebindAlloc<Allocator, NodeType>>;
+        using Stack = std::vector<Frame, utils::RebindAlloc<Allocator, Frame>>;
+
+        TraversalWorkspace() = default;
+
+        /**
+         * @brief Creates an empty workspace whose buffers allocate from alloc.
+         */
+        explicit TraversalWorkspace(const Allocator& alloc)
+            : visited_(alloc), frontier_(alloc), next_frontier_(alloc), dfs_stack_(alloc) {}
+
+        /**
+         * @brief Clears the visited set and sizes it for a traversal of graph.
+         * @param graph The graph about to be traversed.
+         * @return The visited set, with no node marked.
+         */
+        VisitedSet& reset_visited(const GraphType& graph) {
+            if constexpr (IndexedGraph<GraphType>) {
+                visited_.reset(static_cast<std::size_t>(graph.node_count()));
+            } else {
+                visited_.clear();
+            }
+            return visited_;
+        }
+
+        /**
+         * @brief Buffer for the BFS level currently being expanded.
+         */
+        Frontier& frontier() noexcept { return frontier_; }
+
+        /**
+         * @brief Buffer for the BFS level being discovered.
+         */
+        Frontier& next_frontier() noexcept { return next_frontier_; }
+
+        /**
+         * @brief Buffer for the DFS frames; empty between traversals.
+         */
+        Stack& dfs_stack() noexcept { return dfs_stack_; }
+
+    private:
+        VisitedSet visited_;
+        Frontier frontier_;
+        Frontier next_frontier_;
+        Stack dfs_stack_;
+    };
+
+    /**
+     * @brief TraversalWorkspace whose buffers come from a std::pmr::memory_resource.
+     *
+     * @par Example:
+     * ```cpp
+     * std::pmr::monotonic_buffer_resource arena(1 << 20);
+     * algorithms::graph::PmrTraversalWorkspace<algorithms::graph::CsrGraph<>> workspace(&arena);
+     * algorithms::graph::bfs_iterative(graph, source, visit, workspace);
+     * // the arena releases every buffer at once when it goes out of scope
+     * ```
+     *
+     * @ingroup graph
+     */
+    template<Graph GraphType>
+    using PmrTraversalWorkspace =
+        TraversalWorkspace<GraphType, std::pmr::polymorphic_allocator<typename GraphType::NodeType>>;
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
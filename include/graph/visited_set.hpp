@@ -0,0 +1,290 @@
+#pragma once
+
+#include "graph_concept.hpp"
+#include "../utils/allocator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace algorithms {
+namespace graph {
+    /**
+     * @addtogroup graph
+     * @{
+     */
+
+    /**
+     * @brief Visited set backed by a hash set, usable with any regular node type.
+     *
+     * This is the general fallback used by the traversals when the graph does not
+     * satisfy IndexedGraph. Every lookup costs a hash and insertions may allocate.
+     *
+     * @tparam NodeType Hashable node type.
+     * @tparam Allocator Allocator for the buckets and nodes of the hash set.
+     */
+    template<typename NodeType, utils::SimpleAllocator Allocator = std::allocator<NodeType>>
+    class HashVisitedSet {
+    public:
+        HashVisitedSet() = default;
+
+        /**
+         * @brief Creates an empty set that allocates from alloc.
+         */
+        explicit HashVisitedSet(const Allocator& alloc) : visited_(utils::RebindAlloc<Allocator, NodeType>(alloc)) {}
+
+        /**
+         * @brief Checks whether a node has already been marked.
+         * @param node The node to look up.
+         * @return True if the node is in the set.
+         */
+        bool contains(const NodeType& node) const {
+            return visited_.contains(node);
+        }
+
+        /**
+         * @brief Marks a node as visited.
+         * @param node The node to mark.
+         * @return True if the node was not marked before this call.
+         */
+        bool insert(const NodeType& node) {
+            return visited_.insert(node).second;
+        }
+
+        /**
+         * @brief Unmarks every node, keeping the allocated buckets for reuse.
+         */
+        void clear() {
+            visited_.clear();
+        }
+
+    private:
+        std::unordered_set<NodeType, std::hash<NodeType>, std::equal_to<NodeType>,
+                           utils::RebindAlloc<Allocator, NodeType>> visited_;
+    };
+
+    /**
+     * @brief Visited set backed by a packed bitset indexed by node id.
+     *
+     * Uses one bit per node, so a 50M-node graph needs about 6 MB of visited state.
+     * Lookups and insertions are a shift and a mask on a single word, with no hashing
+     * and no allocation after construction.
+     *
+     * @tparam NodeType Integral node type; node ids must lie in `[0, node_count)`.
+     * @tparam Allocator Allocator for the bit words.
+     */
+    template<std::integral NodeType, utils::SimpleAllocator Allocator = std::allocator<NodeType>>
+    class BitsetVisitedSet {
+    public:
+        /**
+         * @brief Creates an empty set able to hold ids in `[0, node_count)`.
+         * @param node_count Number of distinct node ids.
+         * @param alloc Allocator for the bit words.
+         */
+        explicit BitsetVisitedSet(std::size_t node_count, const Allocator& alloc = Allocator())
+            : words_((node_count + word_bits - 1) / word_bits, 0, utils::RebindAlloc<Allocator, std::uint64_t>(alloc)) {}
+
+        /**
+         * @brief Checks whether a node has already been marked.
+         * @param node The node to look up.
+         * @return True if the node is in the set.
+         */
+        bool contains(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            return (words_[index / word_bits] >> (index % word_bits)) & 1u;
+        }
+
+        /**
+         * @brief Marks a node as visited.
+         * @param node The node to mark.
+         * @return True if the node was not marked before this call.
+         */
+        bool insert(NodeType node) {
+            const auto index = static_cast<std::size_t>(node);
+            auto& word = words_[index / word_bits];
+            const std::uint64_t mask = std::uint64_t{1} << (index % word_bits);
+            const bool inserted = (word & mask) == 0;
+            word |= mask;
+            return inserted;
+        }
+
+    private:
+        static constexpr std::size_t word_bits = 64;
+        std::vector<std::uint64_t, utils::RebindAlloc<Allocator, std::uint64_t>> words_;
+    };
+
+    /**
+     * @brief Reusable visited set backed by an epoch-stamped array indexed by node id.
+     *
+     * A node is marked when its stamp equals the current epoch, so reset() only bumps
+     * the epoch instead of touching the array. This makes the set suitable for running
+     * many short traversals back to back with the same storage: clearing is O(1) and
+     * the array is only rewritten when the 32-bit epoch wraps around.
+     *
+     * @tparam NodeType Integral node type; node ids must lie in `[0, node_count)`.
+     * @tparam Allocator Allocator for the stamp array.
+     */
+    template<std::integral NodeType, utils::SimpleAllocator Allocator = std::allocator<NodeType>>
+    class EpochVisitedSet {
+    public:
+        /**
+         * @brief Creates a set with no capacity; call reset() before use.
+         */
+        EpochVisitedSet() = default;
+
+        /**
+         * @brief Creates a set with no capacity that allocates from alloc; call reset() before use.
+         */
+        explicit EpochVisitedSet(const Allocator& alloc) : stamps_(utils::RebindAlloc<Allocator, std::uint32_t>(alloc)) {}
+
+        /**
+         * @brief Creates an empty set able to hold ids in `[0, node_count)`.
+         * @param node_count Number of distinct node ids.
+         * @param alloc Allocator for the stamp array.
+         */
+        explicit EpochVisitedSet(std::size_t node_count, const Allocator& alloc = Allocator())
+            : stamps_(node_count, 0, utils::RebindAlloc<Allocator, std::uint32_t>(alloc)) {}
+
+        /**
+         * @brief Unmarks every node and makes room for ids in `[0, node_count)`.
+         * @param node_count Number of distinct node ids; storage only ever grows.
+         */
+        void reset(std::size_t node_count) {
+            if (stamps_.size() < node_count) {
+                stamps_.resize(node_count, 0);
+            }
+            if (++epoch_ == 0) {
+                std::fill(stamps_.begin(), stamps_.end(), 0);
+                epoch_ = 1;
+            }
+        }
+
+        /**
+         * @brief Checks whether a node has already been marked.
+         * @param node The node to look up.
+         * @return True if the node is in the set.
+         */
+        bool contains(NodeType node) const {
+            return stamps_[static_cast<std::size_t>(node)] == epoch_;
+        }
+
+        /**
+         * @brief Marks a node as visited.
+         * @param node The node to mark.
+         * @return True if the node was not marked before this call.
+         */
+        bool insert(NodeType node) {
+            auto& stamp = stamps_[static_cast<std::size_t>(node)];
+            if (stamp == epoch_) return false;
+            stamp = epoch_;
+            return true;
+        }
+
+    private:
+        std::vector<std::uint32_t, utils::RebindAlloc<Allocator, std::uint32_t>> stamps_;
+        std::uint32_t epoch_ = 1;
+    };
+
+    /**
+     * @brief Thread-safe visited set backed by a packed bitset of atomic words.
+     *
+     * Used by the parallel traversals: insert() is a single `fetch_or`, so when several
+     * threads race to mark the same node exactly one of them observes the insertion.
+     *
+     * @tparam NodeType Integral node type; node ids must lie in `[0, node_count)`.
+     */
+    template<std::integral NodeType>
+    class AtomicBitsetVisitedSet {
+    public:
+        /**
+         * @brief Creates an empty set able to hold ids in `[0, node_count)`.
+         * @param node_count Number of distinct node ids.
+         */
+        explicit AtomicBitsetVisitedSet(std::size_t node_count)
+            : words_((node_count + word_bits - 1) / word_bits) {}
+
+        /**
+         * @brief Checks whether a node has already been marked.
+         * @param node The node to look up.
+         * @return True if the node is in the set.
+         */
+        bool contains(NodeType node) const {
+            const auto index = static_cast<std::size_t>(node);
+            return (words_[index / word_bits].load(std::memory_order_relaxed) >> (index % word_bits)) & 1u;
+        }
+
+        /**
+         * @brief Marks a node as visited; safe to call concurrently.
+         * @param node The node to mark.
+         * @return True if this call is the one that marked the node.
+         */
+        bool insert(NodeType node) {
+            const auto index = static_cast<std::size_t>(node);
+            const std::uint64_t mask = std::uint64_t{1} << (index % word_bits);
+            if (words_[index / word_bits].load(std::memory_order_relaxed) & mask) return false;
+            return (words_[index / word_bits].fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+        }
+
+        /**
+         * @brief Unmarks a node; safe to call concurrently.
+         * @param node The node to unmark.
+         */
+        void erase(NodeType node) {
+            const auto index = static_cast<std::size_t>(node);
+            const std::uint64_t mask = std::uint64_t{1} << (index % word_bits);
+            words_[index / word_bits].fetch_and(~mask, std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::size_t word_bits = 64;
+        std::vector<std::atomic<std::uint64_t>> words_;
+    };
+
+    /**
+     * @brief Creates the cheapest visited set available for a graph type.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @param graph The graph that will be traversed.
+     * @return A BitsetVisitedSet sized to `graph.node_count()` for indexed graphs,
+     *         a HashVisitedSet otherwise.
+     *
+     * @ingroup graph
+     */
+    template<Graph GraphType>
+    auto make_visited_set(const GraphType& graph) {
+        using NodeType = typename GraphType::NodeType;
+        if constexpr (IndexedGraph<GraphType>) {
+            return BitsetVisitedSet<NodeType>(static_cast<std::size_t>(graph.node_count()));
+        } else {
+            return HashVisitedSet<NodeType>{};
+        }
+    }
+
+    /**
+     * @brief Creates the cheapest visited set available for a graph type, allocating from alloc.
+     * @tparam GraphType Graph type satisfying the Graph concept.
+     * @tparam Allocator Allocator type; rebound to the set's storage.
+     * @param graph The graph that will be traversed.
+     * @param alloc Allocator for the set's storage.
+     * @return Same kind of set as make_visited_set(graph).
+     *
+     * @ingroup graph
+     */
+    template<Graph GraphType, utils::SimpleAllocator Allocator>
+    auto make_visited_set(const GraphType& graph, const Allocator& alloc) {
+        using NodeType = typename GraphType::NodeType;
+        if constexpr (IndexedGraph<GraphType>) {
+            return BitsetVisitedSet<NodeType, Allocator>(static_cast<std::size_t>(graph.node_count()), alloc);
+        } else {
+            return HashVisitedSet<NodeType, Allocator>(alloc);
+        }
+    }
+
+    /** @} */ // end of graph group
+
+} // namespace graph
+} // namespace algorithms
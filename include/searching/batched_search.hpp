@@ -0,0 +1,217 @@
+#pragma once
+
+#include "binary_search.hpp"
+#include "../utils/prefetch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace algorithms {
+namespace searching {
+    /**
+     * @addtogroup searching
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Queries searched in lockstep; enough to keep a core's miss buffers busy.
+         */
+        inline constexpr std::size_t batch_lanes = 16;
+
+        /**
+         * @brief Branch-free bound search of `count` queries at once.
+         *
+         * Every branch-free search over the same range halves its size in the same
+         * sequence, so all lanes advance together: each step first updates every lane,
+         * then prefetches the probe of that lane's next step. The loads of up to
+         * batch_lanes independent searches are in flight at the same time instead of
+         * one after the other.
+         *
+         * @tparam Upper False for lower bounds, true for upper bounds.
+         */
+        template<bool Upper, typename Iterator, typename QueryIt, typename Compare>
+        void batched_bounds(Iterator first, typename std::iterator_traits<Iterator>::difference_type size,
+                            QueryIt queries, std::size_t count, Iterator* results, Compare& comp) {
+            for (std::size_t lane = 0; lane < count; ++lane) results[lane] = first;
+            if (size == 0) return;
+
+            while (size > 1) {
+                const auto half = size / 2;
+                const auto next_half = (size - half) / 2;
+                for (std::size_t lane = 0; lane < count; ++lane) {
+                    const auto& value = queries[static_cast<std::ptrdiff_t>(lane)];
+                    auto base = results[lane];
+                    if constexpr (Upper) {
+                        base = comp(value, base[half]) ? base : base + half;
+                    } else {
+                        base = comp(base[half], value) ? base + half : base;
+                    }
+                    results[lane] = base;
+                    utils::prefetch_element(base + next_half);
+                }
+                size -= half;
+            }
+
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                const auto& value = queries[static_cast<std::ptrdiff_t>(lane)];
+                if constexpr (Upper) {
+                    results[lane] += !static_cast<bool>(comp(value, *results[lane]));
+                } else {
+                    results[lane] += static_cast<bool>(comp(*results[lane], value));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Computes lower_bound for many queries against one sorted range.
+     *
+     * Queries are processed in groups of 16 whose branch-free searches run in lockstep,
+     * so the cache misses of a whole group overlap instead of each search paying the
+     * full memory latency on its own. Results are written in query order.
+     *
+     * @tparam Iterator Random access iterator type of the sorted range
+     * @tparam Queries Random access range of values to search for
+     * @tparam OutputIt Output iterator accepting Iterator values
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param queries Values to search for, in any order
+     * @param out Receives one iterator per query, as returned by searching::lower_bound
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Output iterator one past the last result written
+     *
+     * @par Complexity:
+     * - Time: O(q log n) for q queries, with up to 16 memory accesses in flight
+     * - Space: O(1) auxiliary space
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::vector<int>::const_iterator> hits(probe_keys.size());
+     * algorithms::searching::batched_lower_bound(keys.cbegin(), keys.cend(), probe_keys, hits.begin());
+     * ```
+     *
+     * @ingroup searching
+     */
+    template<typename Iterator, std::ranges::random_access_range Queries, typename OutputIt,
+             typename Compare = std::less<>>
+    OutputIt batched_lower_bound(Iterator first, Iterator last, const Queries& queries, OutputIt out,
+                                 Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be a random access iterator for binary search.");
+        const auto query_count = static_cast<std::size_t>(std::ranges::size(queries));
+        std::array<Iterator, detail::batch_lanes> results;
+
+        for (std::size_t begin = 0; begin < query_count; begin += detail::batch_lanes) {
+            const std::size_t count = std::min(detail::batch_lanes, query_count - begin);
+            detail::batched_bounds<false>(first, last - first,
+                                          std::ranges::begin(queries) + static_cast<std::ptrdiff_t>(begin),
+                                          count, results.data(), comp);
+            out = std::copy_n(results.begin(), count, out);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Computes equal_range for many queries against one sorted range.
+     *
+     * Same lockstep technique as batched_lower_bound; the lower and upper bounds of a
+     * group are searched as two interleaved batches.
+     *
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param queries Values to search for, in any order
+     * @param out Receives one `std::pair<Iterator, Iterator>` per query, as returned by
+     *   searching::equal_range
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Output iterator one past the last result written
+     *
+     * @ingroup searching
+     */
+    template<typename Iterator, std::ranges::random_access_range Queries, typename OutputIt,
+             typename Compare = std::less<>>
+    OutputIt batched_equal_range(Iterator first, Iterator last, const Queries& queries, OutputIt out,
+                                 Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be a random access iterator for binary search.");
+        const auto query_count = static_cast<std::size_t>(std::ranges::size(queries));
+        std::array<Iterator, detail::batch_lanes> lower;
+        std::array<Iterator, detail::batch_lanes> upper;
+
+        for (std::size_t begin = 0; begin < query_count; begin += detail::batch_lanes) {
+            const std::size_t count = std::min(detail::batch_lanes, query_count - begin);
+            const auto group = std::ranges::begin(queries) + static_cast<std::ptrdiff_t>(begin);
+            detail::batched_bounds<false>(first, last - first, group, count, lower.data(), comp);
+            detail::batched_bounds<true>(first, last - first, group, count, upper.data(), comp);
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                *out = std::pair<Iterator, Iterator>(lower[lane], upper[lane]);
+                ++out;
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Computes lower_bound for sorted queries, resuming each search where the last ended.
+     *
+     * Since both the range and the queries are sorted, every result is at or after the
+     * previous one. Each search gallops forward from the previous result in steps of
+     * 1, 2, 4, ... and then finishes with a branch-free binary search inside the last
+     * step, so nearby queries cost O(log distance) instead of O(log n), and the whole
+     * batch reads the range strictly front to back.
+     *
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param queries Values to search for, **sorted** according to comp
+     * @param out Receives one iterator per query, as returned by searching::lower_bound
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Output iterator one past the last result written
+     *
+     * @pre queries is sorted according to comp
+     *
+     * @par Complexity:
+     * - Time: O(q log(n / q + 1)), e.g. linear in n + q when the queries are dense
+     * - Space: O(1) auxiliary space
+     *
+     * @ingroup searching
+     */
+    template<typename Iterator, std::ranges::input_range Queries, typename OutputIt,
+             typename Compare = std::less<>>
+    OutputIt batched_lower_bound_sorted(Iterator first, Iterator last, const Queries& queries, OutputIt out,
+                                        Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be a random access iterator for binary search.");
+        auto position = first;
+
+        for (const auto& value : queries) {
+            if (position != last && comp(*position, value)) {
+                // comp(position[covered], value) holds; the bound lies in (covered, step]
+                const auto remaining = last - position;
+                decltype(last - first) covered = 0;
+                decltype(last - first) step = 1;
+                while (step < remaining && comp(position[step], value)) {
+                    covered = step;
+                    step *= 2;
+                }
+                const auto limit = std::min(step, remaining);
+                position = detail::branchless_lower_bound(position + (covered + 1), limit - covered - 1, value, comp);
+            }
+            *out = position;
+            ++out;
+        }
+        return out;
+    }
+
+    /** @} */ // end of searching group
+
+} // namespace searching
+} // namespace algorithms
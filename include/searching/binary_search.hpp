@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../utils/instrumentation.hpp"
+#include "../utils/prefetch.hpp"
 #include <iterator>
 #include <functional>
 #include <utility>
@@ -11,12 +13,129 @@ namespace searching {
      * @{
      */
 
+    namespace detail {
+        /**
+         * @brief Branch-free lower bound of value in [first, first + size).
+         *
+         * Halves the candidate range with a conditional move instead of a branch, so
+         * the loop runs exactly ceil(log2(size)) iterations regardless of the data and
+         * never mispredicts. Both elements that the next iteration may probe are
+         * prefetched, hiding most of the memory latency on large arrays.
+         */
+        template<typename Iterator, typename T, typename Compare>
+        constexpr Iterator branchless_lower_bound(Iterator first,
+                                                  typename std::iterator_traits<Iterator>::difference_type size,
+                                                  const T& value, Compare& comp) {
+            if (size == 0) return first;
+            while (size > 1) {
+                const auto half = size / 2;
+                const auto next_half = (size - half) / 2;
+                utils::prefetch_element(first + next_half);
+                utils::prefetch_element(first + (half + next_half));
+                first = comp(first[half], value) ? first + half : first;
+                size -= half;
+            }
+            return first + static_cast<bool>(comp(*first, value));
+        }
+
+        /**
+         * @brief Branch-free upper bound of value in [first, first + size).
+         */
+        template<typename Iterator, typename T, typename Compare>
+        constexpr Iterator branchless_upper_bound(Iterator first,
+                                                  typename std::iterator_traits<Iterator>::difference_type size,
+                                                  const T& value, Compare& comp) {
+            if (size == 0) return first;
+            while (size > 1) {
+                const auto half = size / 2;
+                const auto next_half = (size - half) / 2;
+                utils::prefetch_element(first + next_half);
+                utils::prefetch_element(first + (half + next_half));
+                first = comp(value, first[half]) ? first : first + half;
+                size -= half;
+            }
+            return first + !static_cast<bool>(comp(value, *first));
+        }
+    }
+
+    /**
+     * @brief Finds the first element in a sorted range that is not ordered before value.
+     * 
+     * Branch-free binary search: each step halves the range with a conditional move and
+     * prefetches both possible next midpoints, so random lookups into large arrays are
+     * bound by memory latency rather than branch mispredictions.
+     * 
+     * @tparam Iterator Random access iterator type
+     * @tparam T Value type to search for, must be comparable with iterator's value type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * 
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param value The value to search for
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Iterator to the first element `e` with `!comp(e, value)`, or last if none
+     * 
+     * @pre The range [first, last) must be partitioned by `comp(e, value)`
+     * 
+     * @par Complexity:
+     * - Time: exactly ceil(log2(n)) + 1 comparisons
+     * - Space: O(1) auxiliary space
+     * 
+     * @par Example:
+     * ```cpp
+     * std::vector<int> data = {1, 3, 5, 5, 7};
+     * auto it = algorithms::searching::lower_bound(data.begin(), data.end(), 5);
+     * // it points to data[2]
+     * ```
+     * 
+     * @ingroup searching
+     */
+    template<typename Iterator, typename T, typename Compare = std::less<>>
+    constexpr Iterator lower_bound(Iterator first, Iterator last, const T& value, Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be a random access iterator for binary search.");
+        return detail::branchless_lower_bound(first, last - first, value, comp);
+    }
+
+    /**
+     * @brief Finds the first element in a sorted range that value is ordered before.
+     * 
+     * Branch-free counterpart of lower_bound; see there for the technique.
+     * 
+     * @tparam Iterator Random access iterator type
+     * @tparam T Value type to search for, must be comparable with iterator's value type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * 
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param value The value to search for
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Iterator to the first element `e` with `comp(value, e)`, or last if none
+     * 
+     * @pre The range [first, last) must be partitioned by `!comp(value, e)`
+     * 
+     * @par Complexity:
+     * - Time: exactly ceil(log2(n)) + 1 comparisons
+     * - Space: O(1) auxiliary space
+     * 
+     * @ingroup searching
+     */
+    template<typename Iterator, typename T, typename Compare = std::less<>>
+    constexpr Iterator upper_bound(Iterator first, Iterator last, const T& value, Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be a random access iterator for binary search.");
+        return detail::branchless_upper_bound(first, last - first, value, comp);
+    }
+
     /**
      * @brief Performs binary search on a sorted range of elements.
      * 
      * Binary search uses divide-and-conquer to efficiently find an element in a sorted range.
      * At each step, it compares the target with the middle element and eliminates half
-     * of the remaining search space.
+     * of the remaining search space. The halving is branch-free (see lower_bound); when
+     * the value occurs several times, the first occurrence is returned.
      * 
      * @tparam Iterator Random access iterator type that must provide:
      *   - Random access capabilities (arithmetic operations)
@@ -28,7 +147,7 @@ namespace searching {
      * @param last Iterator to the end of the **sorted** range
      * @param value The value to search for
      * @param comp Comparison function object (defaults to std::less)
-     * @return Iterator to the found element, or last if not found
+     * @return Iterator to the first element equal to value, or last if not found
      * 
      * @pre The range [first, last) must be sorted according to comp
      * 
@@ -60,24 +179,45 @@ namespace searching {
                                        typename std::iterator_traits<Iterator>::iterator_category>,
                       "Iterator must be a random access iterator for binary search.");
         
-        while (first < last) {
-            auto mid = first + (last - first) / 2;
-            
-            if (comp(*mid, value)) {
-                // *mid < value, search right half
-                first = mid + 1;
-            } else if (comp(value, *mid)) {
-                // value < *mid, search left half
-                last = mid;
-            } else {
-                // *mid == value, found it
-                return mid;
-            }
+        // Branch-free lower bound, then a single equality check
+        auto it = detail::branchless_lower_bound(first, last - first, value, comp);
+        if (it != last && !comp(value, *it)) {
+            return it;
         }
         
         return last; // Not found
     }
 
+    /**
+     * @brief Performs binary search on a sorted range and reports its comparison count.
+     * 
+     * Same search and result as the overload without instrumentation; every call of
+     * comp is counted and finish("binary_search") is called before returning. With
+     * utils::NoInstrumentation this compiles to the plain overload.
+     * 
+     * @tparam Iterator Random access iterator type
+     * @tparam T Value type to search for, must be comparable with iterator's value type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * @tparam Instr Type satisfying utils::Instrumentation
+     * 
+     * @param first Iterator to the beginning of the **sorted** range
+     * @param last Iterator to the end of the **sorted** range
+     * @param value The value to search for
+     * @param comp Comparison function object
+     * @param instrumentation Receives the counts of this call
+     * @return Iterator to the first element equal to value, or last if not found
+     * 
+     * @ingroup searching
+     */
+    template<typename Iterator, typename T, typename Compare, utils::Instrumentation Instr>
+    constexpr Iterator binary_search(Iterator first, Iterator last, const T& value, Compare comp,
+                                     Instr& instrumentation) {
+        auto counted = utils::counting_compare(comp, instrumentation);
+        const auto it = searching::binary_search(first, last, value, counted);
+        instrumentation.finish("binary_search");
+        return it;
+    }
+
     /**
      * @brief Finds the range of all occurrences of a value in a sorted range.
      * 
@@ -85,6 +225,10 @@ namespace searching {
      * returning a pair of iterators that define the range [first_occurrence, one_past_last).
      * This is useful when the sorted range contains duplicate values.
      * 
+     * The two bounds are searched together until the first midpoint equal to value;
+     * only the remaining halves on either side are then searched separately, with the
+     * branch-free lower_bound and upper_bound.
+     * 
      * @tparam Iterator Random access iterator type that must provide:
      *   - Random access capabilities (arithmetic operations)
      *   - Value type must be comparable using Compare function
@@ -125,31 +269,26 @@ namespace searching {
                                        typename std::iterator_traits<Iterator>::iterator_category>,
                       "Iterator must be a random access iterator for binary search.");
         
-        // Find lower bound (first occurrence)
-        auto lower = first;
-        auto upper = last;
-        while (lower < upper) {
-            auto mid = lower + (upper - lower) / 2;
-            if (comp(*mid, value)) {
-                lower = mid + 1;
-            } else {
-                upper = mid;
-            }
-        }
-        
-        // Find upper bound (one past last occurrence)
-        auto lower2 = first;
-        auto upper2 = last;
-        while (lower2 < upper2) {
-            auto mid = lower2 + (upper2 - lower2) / 2;
-            if (comp(value, *mid)) {
-                upper2 = mid;
-            } else {
-                lower2 = mid + 1;
+        // Both bounds share the branch-free descent until a midpoint equal to value
+        // separates them; that split happens at most once, so its branch predicts well
+        auto size = last - first;
+        if (size == 0) return {first, first};
+        while (size > 1) {
+            const auto half = size / 2;
+            const auto mid = first + half;
+            const bool less = comp(*mid, value);
+            if (!less && !comp(value, *mid)) {
+                return {detail::branchless_lower_bound(first, half, value, comp),
+                        detail::branchless_upper_bound(mid + 1, size - half - 1, value, comp)};
             }
+            const auto next_half = (size - half) / 2;
+            utils::prefetch_element(first + next_half);
+            utils::prefetch_element(first + (half + next_half));
+            first = less ? mid : first;
+            size -= half;
         }
         
-        return {lower, upper2};
+        return {first + static_cast<bool>(comp(*first, value)), first + !static_cast<bool>(comp(value, *first))};
     }
 
     /** @} */ // end of searching group
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "../utils/simd.hpp"
+#include <cstddef>
 #include <iterator>
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace algorithms {
 namespace searching {
@@ -17,12 +21,84 @@ namespace searching {
      * @{
      */
 
+    namespace detail {
+        /**
+         * @brief Vectorized search for value in the contiguous array [first, last).
+         *
+         * Compares four registers of elements per iteration (64 bytes with SSE2/NEON,
+         * 128 with AVX2) and ORs the results, so short-circuiting costs one mask
+         * check per step; the first match is then located with a count of trailing
+         * zeros. Elements compare exactly like with operator==, including floats
+         * (NaN never matches, -0.0 matches 0.0).
+         */
+        template<typename T>
+        const T* simd_find(const T* first, const T* last, T value) noexcept {
+#if defined(ALGORITHMS_SIMD)
+            if constexpr (utils::simd::supported<T>) {
+                constexpr std::size_t lanes = utils::simd::width / sizeof(T);
+                const auto needle = utils::simd::broadcast(value);
+
+                while (static_cast<std::size_t>(last - first) >= 4 * lanes) {
+                    const auto e0 = utils::simd::equal<T>(utils::simd::load(first), needle);
+                    const auto e1 = utils::simd::equal<T>(utils::simd::load(first + lanes), needle);
+                    const auto e2 = utils::simd::equal<T>(utils::simd::load(first + 2 * lanes), needle);
+                    const auto e3 = utils::simd::equal<T>(utils::simd::load(first + 3 * lanes), needle);
+                    const auto any = utils::simd::bitwise_or(utils::simd::bitwise_or(e0, e1),
+                                                             utils::simd::bitwise_or(e2, e3));
+                    if (utils::simd::mask(any) != 0) {
+                        if (const auto m = utils::simd::mask(e0)) return first + utils::simd::first_lane<T>(m);
+                        if (const auto m = utils::simd::mask(e1)) return first + lanes + utils::simd::first_lane<T>(m);
+                        if (const auto m = utils::simd::mask(e2)) return first + 2 * lanes + utils::simd::first_lane<T>(m);
+                        return first + 3 * lanes + utils::simd::first_lane<T>(utils::simd::mask(e3));
+                    }
+                    first += 4 * lanes;
+                }
+
+                while (static_cast<std::size_t>(last - first) >= lanes) {
+                    const auto m = utils::simd::mask(utils::simd::equal<T>(utils::simd::load(first), needle));
+                    if (m != 0) return first + utils::simd::first_lane<T>(m);
+                    first += lanes;
+                }
+            }
+#endif
+
+            for (; first != last; ++first) {
+                if (*first == value) return first;
+            }
+            return last;
+        }
+
+        /**
+         * @brief True if linear_search over Iterator for a T can use simd_find.
+         *
+         * Needs contiguous storage of a supported arithmetic type, and a value of the
+         * same type or, for integers, any integer type: equality between integers is
+         * then decided by the value converted to the element type.
+         */
+        template<typename Iterator, typename T>
+        inline constexpr bool simd_searchable = [] {
+            if constexpr (std::contiguous_iterator<Iterator>) {
+                using ValueType = std::iter_value_t<Iterator>;
+                return utils::simd::supported<ValueType> &&
+                       (std::is_same_v<ValueType, T> || (std::is_integral_v<ValueType> && std::is_integral_v<T> &&
+                                                         !std::is_same_v<T, bool>));
+            } else {
+                return false;
+            }
+        }();
+    }
+
     /**
      * @brief Performs linear search on a range of elements.
      * 
      * Linear search sequentially checks each element in the range until the target
      * value is found or the end of the range is reached. Works on any forward iterator.
      * 
+     * For contiguous ranges of integers, float or double (e.g. std::vector, std::array,
+     * std::span), the search is vectorized at compile time with AVX2, SSE2 or NEON,
+     * whichever the target enables, comparing 16 to 128 elements per step. Other
+     * ranges, other targets and constant evaluation use the element-by-element loop.
+     * 
      * @tparam Iterator Forward iterator type that must provide:
      *   - Forward iteration capabilities
      *   - Value type must be equality comparable with T
@@ -41,6 +117,7 @@ namespace searching {
      * - Works on unsorted data
      * - Sequential access pattern (cache-friendly for arrays)
      * - Early termination when element is found
+     * - SIMD-accelerated for contiguous arithmetic ranges
      * 
      * @par Example:
      * ```cpp
@@ -60,6 +137,18 @@ namespace searching {
                       std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>,
                       "Iterator must be at least a forward iterator.");
 
+        if constexpr (detail::simd_searchable<Iterator, T>) {
+            if (!std::is_constant_evaluated()) {
+                using ValueType = std::iter_value_t<Iterator>;
+                // An element can only equal value if value survives conversion to the element type
+                using Common = std::common_type_t<ValueType, T>;
+                const auto needle = static_cast<ValueType>(value);
+                if (static_cast<Common>(needle) != static_cast<Common>(value)) return last;
+                const ValueType* data = std::to_address(first);
+                return first + (detail::simd_find(data, data + (last - first), needle) - data);
+            }
+        }
+
         for (auto it = first; it != last; ++it) {
             if (*it == value) {
                 return it;
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "binary_search.hpp"
+#include "../utils/simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace searching {
+    /**
+     * @addtogroup searching
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Value sets up to this size are probed by comparing against each value.
+         */
+        inline constexpr std::size_t small_value_set = 8;
+
+        template<typename T>
+        concept NonBoolIntegral = std::is_integral_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
+
+        /**
+         * @brief The standard integer type of T's width and signedness, for std::in_range.
+         *
+         * std::in_range rejects character types, which convert to this type without
+         * changing value.
+         */
+        template<NonBoolIntegral T>
+        using StandardInteger = std::conditional_t<std::is_signed_v<T>, std::make_signed_t<T>, std::make_unsigned_t<T>>;
+
+        /**
+         * @brief value converted to T, or nullopt if T cannot represent it exactly.
+         *
+         * Arithmetic values are kept only if converting to T and back gives the same
+         * value, so that an element matches exactly when it equals the value itself;
+         * the range checks keep every conversion defined. Other types are converted
+         * with static_cast.
+         */
+        template<typename T, typename V>
+        std::optional<T> exact_conversion(const V& value) {
+            if constexpr (NonBoolIntegral<T> && NonBoolIntegral<V>) {
+                if (!std::in_range<StandardInteger<T>>(static_cast<StandardInteger<V>>(value))) return std::nullopt;
+                return static_cast<T>(value);
+            } else if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<V>) {
+                if constexpr (std::is_integral_v<T> && std::is_floating_point_v<V>) {
+                    // [lower, 2^digits) holds exactly the values whose truncation T can represent
+                    const V upper = std::ldexp(V(1), std::numeric_limits<T>::digits);
+                    const V lower = std::numeric_limits<T>::is_signed ? -upper : V(0);
+                    if (!(value >= lower && value < upper)) return std::nullopt;
+                } else if constexpr (std::is_floating_point_v<T> && std::is_floating_point_v<V>) {
+                    if (std::isfinite(value) && std::abs(value) > std::numeric_limits<T>::max()) return std::nullopt;
+                }
+                const T converted = static_cast<T>(value);
+                if constexpr (std::is_floating_point_v<T> && std::is_integral_v<V>) {
+                    // Rounding may carry converted just past V's range, where converting back is undefined
+                    const T upper = std::ldexp(T(1), std::numeric_limits<V>::digits);
+                    const T lower = std::numeric_limits<V>::is_signed ? -upper : T(0);
+                    if (!(converted >= lower && converted < upper)) return std::nullopt;
+                }
+                if (static_cast<V>(converted) != value) return std::nullopt;
+                return converted;
+            } else {
+                return static_cast<T>(value);
+            }
+        }
+
+        template<typename T>
+        concept StdHashable = requires(const T& value) {
+            { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+        };
+
+        /**
+         * @brief Calls emit(index) for every element of [data, data + size) equal to a value.
+         *
+         * One register of elements is compared against every broadcast value and the
+         * results are ORed, so the data is read once whatever the number of values.
+         */
+        template<typename T, typename Emit>
+        void simd_find_all(const T* data, std::size_t size, std::span<const T> values, Emit& emit) {
+            std::size_t i = 0;
+#if defined(ALGORITHMS_SIMD)
+            if constexpr (utils::simd::supported<T>) {
+                constexpr std::size_t lanes = utils::simd::width / sizeof(T);
+                constexpr unsigned lane_bits = sizeof(T) * utils::simd::mask_bits_per_byte;
+                constexpr std::uint64_t lane_mask = (std::uint64_t{1} << lane_bits) - 1;
+
+                utils::simd::Register needles[small_value_set];
+                for (std::size_t k = 0; k < values.size(); ++k) needles[k] = utils::simd::broadcast(values[k]);
+
+                for (; i + lanes <= size; i += lanes) {
+                    const auto block = utils::simd::load(data + i);
+                    auto hits = utils::simd::equal<T>(block, needles[0]);
+                    for (std::size_t k = 1; k < values.size(); ++k) {
+                        hits = utils::simd::bitwise_or(hits, utils::simd::equal<T>(block, needles[k]));
+                    }
+                    for (auto m = utils::simd::mask(hits); m != 0;) {
+                        const std::size_t lane = utils::simd::first_lane<T>(m);
+                        emit(i + lane);
+                        m &= ~(lane_mask << (lane * lane_bits));
+                    }
+                }
+            }
+#endif
+
+            for (; i < size; ++i) {
+                if (std::find(values.begin(), values.end(), data[i]) != values.end()) emit(i);
+            }
+        }
+
+        /**
+         * @brief Calls emit(index) for every element of [first, last) equal to one of values.
+         *
+         * Chooses the membership probe by the number of distinct values k: a compare
+         * against each value for small k (vectorized over contiguous arithmetic data),
+         * otherwise a hash set, or a sorted array with branch-free lower_bound for
+         * types without std::hash.
+         */
+        template<typename Iterator, typename Values, typename Emit>
+        void for_each_match(Iterator first, Iterator last, const Values& values, Emit emit) {
+            using ValueType = std::iter_value_t<Iterator>;
+
+            std::vector<ValueType> set;
+            for (const auto& value : values) {
+                // A value the element type cannot represent exactly cannot match any element
+                if (auto converted = detail::exact_conversion<ValueType>(value)) set.push_back(std::move(*converted));
+            }
+            if (set.empty()) return;
+
+            if (set.size() <= small_value_set) {
+                if constexpr (std::contiguous_iterator<Iterator> && utils::simd::supported<ValueType>) {
+                    simd_find_all(std::to_address(first), static_cast<std::size_t>(last - first),
+                                  std::span<const ValueType>(set), emit);
+                } else {
+                    std::size_t index = 0;
+                    for (auto it = first; it != last; ++it, ++index) {
+                        if (std::find(set.begin(), set.end(), *it) != set.end()) emit(index);
+                    }
+                }
+            } else if constexpr (StdHashable<ValueType>) {
+                const std::unordered_set<ValueType> probe(set.begin(), set.end());
+                std::size_t index = 0;
+                for (auto it = first; it != last; ++it, ++index) {
+                    if (probe.contains(*it)) emit(index);
+                }
+            } else {
+                std::sort(set.begin(), set.end());
+                std::less<> comp;
+                const auto size = static_cast<std::ptrdiff_t>(set.size());
+                std::size_t index = 0;
+                for (auto it = first; it != last; ++it, ++index) {
+                    auto candidate = branchless_lower_bound(set.cbegin(), size, *it, comp);
+                    if (candidate != set.cend() && !comp(*it, *candidate)) emit(index);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Finds the positions of all elements equal to any value of a set, in one pass.
+     *
+     * Evaluates a filter such as `column IN (v1, ..., vk)` with a single read of the
+     * data. The membership probe is chosen by the size of the value set: up to 8 values
+     * are compared directly, using SIMD broadcast compares for contiguous ranges of
+     * integers, float or double; larger sets use a hash set, or a sorted array if the
+     * element type has no std::hash specialization.
+     *
+     * @tparam Iterator Forward iterator type
+     * @tparam Values Input range of values, converted to the element type; arithmetic
+     *   values the element type cannot represent exactly (out of range, fractional, or
+     *   rounded, e.g. 2.5 for int or 0.1 for float elements) are ignored, since no
+     *   element could equal them
+     * @tparam OutputIt Output iterator accepting std::size_t
+     *
+     * @param first Iterator to the beginning of the range
+     * @param last Iterator to the end of the range
+     * @param values The values to look for; duplicates are allowed
+     * @param out Receives the zero-based index of every matching element, in increasing order
+     * @return Output iterator one past the last index written
+     *
+     * @par Complexity:
+     * - Time: O(n * k / w) for small sets with w elements per register, O(n) expected
+     *   with a hash set, O(n log k) with a sorted array
+     * - Space: O(k)
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::uint32_t> country = load_column();
+     * std::vector<std::size_t> rows;
+     * algorithms::searching::find_all_of(country.begin(), country.end(),
+     *                                    std::array{7u, 33u, 49u}, std::back_inserter(rows));
+     * ```
+     *
+     * @ingroup searching
+     */
+    template<typename Iterator, std::ranges::input_range Values, typename OutputIt>
+    OutputIt find_all_of(Iterator first, Iterator last, const Values& values, OutputIt out) {
+        static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be at least a forward iterator.");
+
+        detail::for_each_match(first, last, values, [&out](std::size_t index) {
+            *out = index;
+            ++out;
+        });
+        return out;
+    }
+
+    /**
+     * @brief Marks all elements equal to any value of a set in a bitmap, in one pass.
+     *
+     * Same search as find_all_of, but the result is a dense bitmap: bit `i % 64` of
+     * word `i / 64` is set if element i matches. Bits of non-matching elements are
+     * cleared, and words past the range are left untouched.
+     *
+     * @param first Iterator to the beginning of the range
+     * @param last Iterator to the end of the range
+     * @param values The values to look for
+     * @param bitmap Destination of at least `ceil(n / 64)` words
+     * @return Number of matching elements
+     * @throws std::invalid_argument If the bitmap is too small for the range
+     *
+     * @ingroup searching
+     */
+    template<typename Iterator, std::ranges::input_range Values>
+    std::size_t find_all_of(Iterator first, Iterator last, const Values& values, std::span<std::uint64_t> bitmap) {
+        static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>,
+                      "Iterator must be at least a forward iterator.");
+
+        const auto size = static_cast<std::size_t>(std::distance(first, last));
+        const std::size_t words = (size + 63) / 64;
+        if (bitmap.size() < words) {
+            throw std::invalid_argument("bitmap must hold one bit per element");
+        }
+
+        std::fill_n(bitmap.begin(), words, std::uint64_t{0});
+        std::size_t matches = 0;
+        detail::for_each_match(first, last, values, [&](std::size_t index) {
+            bitmap[index / 64] |= std::uint64_t{1} << (index % 64);
+            ++matches;
+        });
+        return matches;
+    }
+
+    /** @} */ // end of searching group
+
+} // namespace searching
+} // namespace algorithms
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "linear_search.hpp"
+#include "../utils/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace algorithms {
+namespace searching {
+    /**
+     * @addtogroup searching
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Target number of chunks per thread, so a slow chunk does not stall the others.
+         */
+        inline constexpr std::size_t search_chunks_per_thread = 16;
+
+        /**
+         * @brief Elements checked between two looks at the shared best match.
+         */
+        inline constexpr std::size_t search_cancel_interval = 64;
+
+        /**
+         * @brief Lowers best to candidate unless it already holds a smaller index.
+         */
+        inline void fetch_min(std::atomic<std::size_t>& best, std::size_t candidate) noexcept {
+            std::size_t current = best.load(std::memory_order_relaxed);
+            while (candidate < current &&
+                   !best.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    /**
+     * @brief Finds the first element satisfying a predicate on several threads.
+     *
+     * The range is split into chunks that the threads claim in increasing order. All
+     * threads share the smallest matching index found so far: a chunk that starts
+     * past it is skipped, and a chunk being scanned stops as soon as it is passed, so
+     * little work is wasted once an early match exists. The result is the first match
+     * in sequence order, exactly as with the serial linear_search_if.
+     *
+     * @tparam RandomIt Random access iterator type
+     * @tparam Pred Unary predicate type compatible with `bool(ValueType)`; it is called
+     *   concurrently and must be safe to do so
+     *
+     * @param policy Number of threads to use
+     * @param first Iterator to the beginning of the range
+     * @param last Iterator to the end of the range
+     * @param pred Predicate function that returns true for the desired element
+     * @return Iterator to the first element satisfying the predicate, or last if none found
+     *
+     * @par Complexity:
+     * - Time: O(n) predicate calls in the worst case, O(n / p) span with p threads;
+     *   elements after the first match are mostly not examined
+     * - Space: O(1) auxiliary space
+     *
+     * @par Example:
+     * ```cpp
+     * auto it = algorithms::searching::linear_search_if(algorithms::utils::ParallelPolicy{16},
+     *     lines.begin(), lines.end(), [](const std::string& line) { return matches(line); });
+     * ```
+     *
+     * @ingroup searching
+     */
+    template<typename RandomIt, typename Pred>
+    RandomIt linear_search_if(const utils::ParallelPolicy& policy, RandomIt first, RandomIt last, Pred pred) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for parallel linear search.");
+
+        const auto count = static_cast<std::size_t>(last - first);
+        const std::size_t thread_count = policy.resolved_thread_count();
+        if (thread_count <= 1 || count < 2) {
+            return linear_search_if(first, last, pred);
+        }
+
+        std::atomic<std::size_t> best{count};
+        const std::size_t grain = std::max<std::size_t>(1, count / (thread_count * detail::search_chunks_per_thread));
+
+        utils::parallel_for_chunks(thread_count, count, grain,
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t block = begin; block < end; block += detail::search_cancel_interval) {
+                    // An earlier match anywhere makes the rest of this chunk irrelevant
+                    if (best.load(std::memory_order_relaxed) <= block) return;
+                    const std::size_t block_end = std::min(end, block + detail::search_cancel_interval);
+                    for (std::size_t i = block; i < block_end; ++i) {
+                        if (pred(first[static_cast<std::ptrdiff_t>(i)])) {
+                            detail::fetch_min(best, i);
+                            return;
+                        }
+                    }
+                }
+            });
+
+        return first + static_cast<std::ptrdiff_t>(best.load(std::memory_order_relaxed));
+    }
+
+    /** @} */ // end of searching group
+
+} // namespace searching
+} // namespace algorithms
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "../utils/prefetch.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace searching {
+    /**
+     * @addtogroup searching
+     * @{
+     */
+
+    /**
+     * @brief Read-only sorted set laid out in Eytzinger (BFS) order for fast lookups.
+     *
+     * The sorted input is rearranged once so that the root of the implicit binary
+     * search tree comes first, followed by its two children, then the four nodes of
+     * the next level, and so on. A search walks from node k to node 2k or 2k + 1, so
+     * the first levels of every search share a handful of hot cache lines, and the 16
+     * descendants four levels down are adjacent in memory: every cache line they span
+     * (one or two for 4-byte keys, two or three for 8-byte keys, as the block need not
+     * start on a line boundary) is prefetched while the current level is compared.
+     * Lookups need far fewer cache misses than a binary search over the sorted array,
+     * and the descent is branch-free.
+     *
+     * Queries follow the same Compare semantics as searching::lower_bound.
+     *
+     * @tparam T Element type; must be default constructible and copy assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @par Complexity:
+     * - Construction: O(n)
+     * - lower_bound / find: O(log n)
+     * - Space: n + 1 elements
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::uint32_t> keys = load_sorted_keys();
+     * algorithms::searching::StaticSearchIndex<std::uint32_t> index(keys.begin(), keys.end());
+     * if (const std::uint32_t* hit = index.find(key)) { ... }
+     * ```
+     *
+     * @ingroup searching
+     */
+    template<typename T, typename Compare = std::less<>>
+    class StaticSearchIndex {
+    public:
+        /**
+         * @brief Creates an empty index.
+         */
+        StaticSearchIndex() : nodes_(1) {}
+
+        /**
+         * @brief Builds the index from a sorted range.
+         * @param first Iterator to the beginning of the **sorted** range
+         * @param last Iterator to the end of the **sorted** range
+         * @param comp Comparison function object (defaults to std::less)
+         * @throws std::invalid_argument If the range is not sorted according to comp
+         */
+        template<typename Iterator>
+        StaticSearchIndex(Iterator first, Iterator last, Compare comp = {})
+            : comp_(std::move(comp)) {
+            static_assert(std::is_base_of_v<std::forward_iterator_tag,
+                                           typename std::iterator_traits<Iterator>::iterator_category>,
+                          "Iterator must be a forward iterator for static search index.");
+            if (!std::is_sorted(first, last, comp_)) {
+                throw std::invalid_argument("StaticSearchIndex requires a sorted range");
+            }
+
+            // Index 0 is unused so that the children of node k are 2k and 2k + 1
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+            nodes_.resize(size + 1);
+            fill(first, 1);
+        }
+
+        std::size_t size() const noexcept { return nodes_.size() - 1; }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        /**
+         * @brief Finds the first element, in sorted order, that is not ordered before value.
+         * @param value The value to search for
+         * @return Pointer to that element, or nullptr if every element is ordered before value
+         */
+        template<typename U>
+        const T* lower_bound(const U& value) const {
+            const std::size_t n = size();
+            std::size_t k = 1;
+            while (k <= n) {
+                prefetch_descendants(k);
+                k = 2 * k + static_cast<std::size_t>(static_cast<bool>(comp_(nodes_[k], value)));
+            }
+            // Undo the trailing right turns and the final left turn
+            k >>= std::countr_one(k) + 1;
+            return k == 0 ? nullptr : nodes_.data() + k;
+        }
+
+        /**
+         * @brief Finds an element equivalent to value.
+         * @param value The value to search for
+         * @return Pointer to the first such element in sorted order, or nullptr if none
+         */
+        template<typename U>
+        const T* find(const U& value) const {
+            const T* candidate = lower_bound(value);
+            return candidate != nullptr && !comp_(value, *candidate) ? candidate : nullptr;
+        }
+
+        /**
+         * @brief True if an element equivalent to value is present.
+         */
+        template<typename U>
+        bool contains(const U& value) const { return find(value) != nullptr; }
+
+    private:
+        static constexpr std::size_t prefetch_stride = 16;
+        static constexpr std::uintptr_t cache_line = 64;
+
+        // Prefetches each cache line holding part of the block of 16 descendants four levels below k
+        void prefetch_descendants(std::size_t k) const noexcept {
+            const std::size_t first = k * prefetch_stride;
+            if (first >= nodes_.size()) return;
+            const std::size_t last = std::min(first + prefetch_stride, nodes_.size());
+            const auto end = reinterpret_cast<std::uintptr_t>(nodes_.data() + last);
+            for (auto line = reinterpret_cast<std::uintptr_t>(nodes_.data() + first) & ~(cache_line - 1); line < end;
+                 line += cache_line) {
+                utils::prefetch(reinterpret_cast<const void*>(line));
+            }
+        }
+
+        // In-order walk of the implicit tree, consuming the sorted input in order
+        template<typename Iterator>
+        Iterator fill(Iterator it, std::size_t k) {
+            if (k < nodes_.size()) {
+                it = fill(it, 2 * k);
+                nodes_[k] = *it;
+                ++it;
+                it = fill(it, 2 * k + 1);
+            }
+            return it;
+        }
+
+        std::vector<T> nodes_;
+        Compare comp_;
+    };
+
+    /** @} */ // end of searching group
+
+} // namespace searching
+} // namespace algorithms
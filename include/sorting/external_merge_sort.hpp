@@ -0,0 +1,323 @@
+#pragma once
+
+#include "kway_merge.hpp"
+#include "merge_sort.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace sorting {
+    /**
+     * @addtogroup sorting
+     * @{
+     */
+
+    /**
+     * @brief Resource limits for external_merge_sort.
+     *
+     * @ingroup sorting
+     */
+    struct ExternalSortOptions {
+        /// Bytes of record storage the sort may hold in memory at once
+        std::size_t memory_budget = std::size_t{64} << 20;
+        /// Maximum number of runs merged together in one pass (at least 2)
+        std::size_t fan_in = 64;
+        /// Directory for the temporary run files; empty selects the system temporary directory
+        std::filesystem::path temp_directory;
+    };
+
+    namespace detail {
+        struct FileCloser {
+            void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+        };
+
+        using FileHandle = std::unique_ptr<std::FILE, FileCloser>;
+
+        inline FileHandle open_file(const std::filesystem::path& path, const char* mode) {
+            FileHandle file(std::fopen(path.string().c_str(), mode));
+            if (!file) {
+                throw std::runtime_error("cannot open file: " + path.string());
+            }
+            return file;
+        }
+
+        /**
+         * @brief Reads up to records.size() records; returns how many were read.
+         */
+        template<typename T>
+        std::size_t read_records(std::FILE* file, std::span<T> records) {
+            const std::size_t count = std::fread(records.data(), sizeof(T), records.size(), file);
+            if (count < records.size() && std::ferror(file)) {
+                throw std::runtime_error("error reading records");
+            }
+            return count;
+        }
+
+        template<typename T>
+        void write_records(std::FILE* file, std::span<const T> records) {
+            if (std::fwrite(records.data(), sizeof(T), records.size(), file) != records.size()) {
+                throw std::runtime_error("error writing records");
+            }
+        }
+
+        /**
+         * @brief A run file that is deleted when the object goes away.
+         */
+        class TempRunFile {
+        public:
+            explicit TempRunFile(std::filesystem::path path) : path_(std::move(path)) {}
+
+            TempRunFile(TempRunFile&& other) noexcept : path_(std::exchange(other.path_, {})) {}
+
+            TempRunFile& operator=(TempRunFile&& other) noexcept {
+                if (this != &other) {
+                    remove();
+                    path_ = std::exchange(other.path_, {});
+                }
+                return *this;
+            }
+
+            ~TempRunFile() { remove(); }
+
+            const std::filesystem::path& path() const noexcept { return path_; }
+
+        private:
+            void remove() noexcept {
+                if (!path_.empty()) {
+                    std::error_code ignored;
+                    std::filesystem::remove(path_, ignored);
+                }
+            }
+
+            std::filesystem::path path_;
+        };
+
+        /**
+         * @brief Hands out unique run file names inside one directory.
+         */
+        class RunNamer {
+        public:
+            explicit RunNamer(std::filesystem::path directory)
+                : directory_(std::move(directory)), prefix_(std::to_string(std::random_device{}())) {}
+
+            TempRunFile next() {
+                return TempRunFile(directory_ / ("algorithms-sort-" + prefix_ + "-" + std::to_string(count_++) + ".run"));
+            }
+
+        private:
+            std::filesystem::path directory_;
+            std::string prefix_;
+            std::size_t count_ = 0;
+        };
+
+        /**
+         * @brief Buffered sequential reader over the records of one sorted run.
+         */
+        template<typename T>
+        class RunReader {
+        public:
+            RunReader(const std::filesystem::path& path, std::size_t buffer_records)
+                : file_(open_file(path, "rb")), buffer_(std::max<std::size_t>(buffer_records, 1)) {
+                refill();
+            }
+
+            bool empty() const noexcept { return pos_ == size_; }
+
+            const T& front() const noexcept { return buffer_[pos_]; }
+
+            void pop() {
+                if (++pos_ == size_) refill();
+            }
+
+        private:
+            void refill() {
+                size_ = read_records(file_.get(), std::span<T>(buffer_));
+                pos_ = 0;
+            }
+
+            FileHandle file_;
+            std::vector<T> buffer_;
+            std::size_t pos_ = 0;
+            std::size_t size_ = 0;
+        };
+
+        /**
+         * @brief Buffered sequential writer of records.
+         */
+        template<typename T>
+        class RecordWriter {
+        public:
+            RecordWriter(const std::filesystem::path& path, std::size_t buffer_records)
+                : file_(open_file(path, "wb")) {
+                buffer_.reserve(std::max<std::size_t>(buffer_records, 1));
+            }
+
+            void push(const T& record) {
+                buffer_.push_back(record);
+                if (buffer_.size() == buffer_.capacity()) flush();
+            }
+
+            void close() {
+                flush();
+                if (std::fclose(file_.release()) != 0) {
+                    throw std::runtime_error("error closing output file");
+                }
+            }
+
+        private:
+            void flush() {
+                write_records(file_.get(), std::span<const T>(buffer_));
+                buffer_.clear();
+            }
+
+            FileHandle file_;
+            std::vector<T> buffer_;
+        };
+
+        /**
+         * @brief Merges sorted run files into one file with a loser tree over the run heads.
+         *
+         * Ties are broken by run index. Runs are produced in input order, so this keeps
+         * equal records in their original relative order.
+         */
+        template<typename T, typename Compare>
+        void merge_run_files(std::span<const TempRunFile> runs, const std::filesystem::path& output,
+                             std::size_t memory_budget, Compare& comp) {
+            const std::size_t buffer_records = memory_budget / sizeof(T) / (runs.size() + 1);
+
+            std::vector<RunReader<T>> readers;
+            readers.reserve(runs.size());
+            for (const auto& run : runs) {
+                readers.emplace_back(run.path(), buffer_records);
+            }
+
+            LoserTree<RunReader<T>, Compare> heads(std::move(readers), comp);
+
+            RecordWriter<T> writer(output, buffer_records);
+            for (; !heads.empty(); heads.pop()) {
+                writer.push(heads.front());
+            }
+            writer.close();
+        }
+    }
+
+    /**
+     * @brief Sorts a file of fixed-width records that may be far larger than memory.
+     *
+     * The input is read in runs that fit the memory budget, each run is sorted with
+     * the bottom-up merge sort and spilled to a temporary file, and the runs are then
+     * merged, at most `fan_in` at a time, until a single run remains; the last merge
+     * writes straight to the output file. Every file is read and written
+     * sequentially through large buffers, so I/O streams at disk bandwidth.
+     *
+     * Records are raw objects of type T as laid out in memory (e.g. written with
+     * fwrite), so T must be trivially copyable. The input file size must be a
+     * multiple of sizeof(T).
+     *
+     * @tparam T Record type; must be trivially copyable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @param input Path of the file to sort
+     * @param output Path of the sorted file to write; must differ from input
+     * @param comp Comparison function object (defaults to std::less)
+     * @param options Memory budget, merge fan-in and temporary directory
+     * @throws std::invalid_argument If the options leave room for fewer than two
+     *   records or the fan-in is below 2
+     * @throws std::runtime_error If a file cannot be opened, read or written, or the
+     *   input size is not a multiple of sizeof(T)
+     *
+     * @par Complexity:
+     * - Time: O(n log n) comparisons; the input is read and written about
+     *   1 + log_fan_in(n / run_length) times
+     * - Space: O(memory_budget) in memory, O(n) temporary disk space
+     *
+     * @par Algorithm Properties:
+     * - Stable: Yes (equal records maintain relative order)
+     * - Temporary run files are removed, also when an exception is thrown
+     *
+     * @par Example:
+     * ```cpp
+     * struct Row { std::uint64_t key; char payload[56]; };
+     * algorithms::sorting::ExternalSortOptions options;
+     * options.memory_budget = std::size_t{4} << 30;
+     * algorithms::sorting::external_merge_sort<Row>("rows.bin", "rows.sorted.bin",
+     *     [](const Row& a, const Row& b) { return a.key < b.key; }, options);
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<typename T, typename Compare = std::less<>>
+    void external_merge_sort(const std::filesystem::path& input, const std::filesystem::path& output,
+                             Compare comp = {}, const ExternalSortOptions& options = {}) {
+        static_assert(std::is_trivially_copyable_v<T>, "External sort records must be trivially copyable.");
+
+        if (options.fan_in < 2) {
+            throw std::invalid_argument("fan_in must be at least 2");
+        }
+        // Run formation keeps a run and an equally sized merge buffer in memory
+        const std::size_t run_records = options.memory_budget / sizeof(T) / 2;
+        if (run_records < 1 || options.memory_budget / sizeof(T) < options.fan_in + 1) {
+            throw std::invalid_argument("memory_budget is too small for the record size and fan_in");
+        }
+        if (std::filesystem::file_size(input) % sizeof(T) != 0) {
+            throw std::runtime_error("input size is not a multiple of the record size");
+        }
+
+        detail::RunNamer namer(options.temp_directory.empty() ? std::filesystem::temp_directory_path()
+                                                               : options.temp_directory);
+        std::vector<detail::TempRunFile> runs;
+
+        {
+            std::vector<T> run(run_records);
+            std::vector<T> scratch(run_records);
+            auto in = detail::open_file(input, "rb");
+            while (true) {
+                const std::size_t count = detail::read_records(in.get(), std::span<T>(run));
+                if (count == 0) break;
+                merge_sort_bottom_up(run.begin(), run.begin() + static_cast<std::ptrdiff_t>(count), comp,
+                                     std::span<T>(scratch));
+
+                // A single run that holds the whole input is the result
+                const bool only_run = runs.empty() && count < run_records;
+                auto target = only_run ? detail::TempRunFile(std::filesystem::path{}) : namer.next();
+                auto out = detail::open_file(only_run ? output : target.path(), "wb");
+                detail::write_records(out.get(), std::span<const T>(run.data(), count));
+                if (std::fclose(out.release()) != 0) {
+                    throw std::runtime_error("error closing run file");
+                }
+                if (only_run) return;
+                runs.push_back(std::move(target));
+                if (count < run_records) break;
+            }
+        }
+
+        while (runs.size() > options.fan_in) {
+            std::vector<detail::TempRunFile> merged;
+            for (std::size_t begin = 0; begin < runs.size(); begin += options.fan_in) {
+                const std::size_t end = std::min(begin + options.fan_in, runs.size());
+                auto target = namer.next();
+                detail::merge_run_files<T>(std::span<const detail::TempRunFile>(runs.data() + begin, end - begin),
+                                           target.path(), options.memory_budget, comp);
+                merged.push_back(std::move(target));
+            }
+            runs = std::move(merged);
+        }
+
+        detail::merge_run_files<T>(std::span<const detail::TempRunFile>(runs), output, options.memory_budget, comp);
+    }
+
+    /** @} */ // end of sorting group
+
+} // namespace sorting
+} // namespace algorithms
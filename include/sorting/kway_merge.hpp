@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace sorting {
+    /**
+     * @addtogroup sorting
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Merge source reading one sorted range through an iterator and sentinel.
+         */
+        template<typename Iterator, typename Sentinel>
+        class RangeCursor {
+        public:
+            RangeCursor(Iterator first, Sentinel last) : it_(std::move(first)), end_(std::move(last)) {}
+
+            bool empty() const { return it_ == end_; }
+
+            decltype(auto) front() const { return *it_; }
+
+            void pop() { ++it_; }
+
+        private:
+            Iterator it_;
+            Sentinel end_;
+        };
+    }
+
+    /**
+     * @brief Tournament tree that repeatedly yields the smallest head among k sorted sources.
+     *
+     * Each internal node remembers the loser of the match played there and the overall
+     * winner is kept at the top. Taking the winner and advancing its source replays only
+     * the matches on that source's leaf-to-root path, so every element costs about
+     * log2(k) comparisons, against which a binary heap needs up to twice as many.
+     *
+     * Merging is lazy: elements are produced one at a time by front() and pop(), so the
+     * output can be fed straight into a consumer without materializing it.
+     *
+     * Ties are won by the source with the lower index, so merging runs given in their
+     * original order is stable.
+     *
+     * @tparam Source Type with `bool empty()`, `front()` returning the current element
+     *   and `void pop()` advancing to the next one; each source must be sorted by Compare
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @ingroup sorting
+     */
+    template<typename Source, typename Compare = std::less<>>
+    class LoserTree {
+    public:
+        /**
+         * @brief Builds the tree over the given sources.
+         * @param sources The sorted sources, in tie-breaking order
+         * @param comp Comparison function object
+         *
+         * Plays the initial tournament with k - 1 comparisons.
+         */
+        explicit LoserTree(std::vector<Source> sources, Compare comp = {})
+            : sources_(std::move(sources)), comp_(std::move(comp)), losers_(sources_.size()) {
+            const std::size_t k = sources_.size();
+            if (k == 0) return;
+
+            // Leaves sit at positions [k, 2k) of an implicit heap layout
+            std::vector<std::size_t> winners(2 * k);
+            for (std::size_t i = 0; i < k; ++i) winners[k + i] = i;
+            for (std::size_t node = k - 1; node >= 1; --node) {
+                const std::size_t a = winners[2 * node];
+                const std::size_t b = winners[2 * node + 1];
+                if (beats(a, b)) {
+                    winners[node] = a;
+                    losers_[node] = b;
+                } else {
+                    winners[node] = b;
+                    losers_[node] = a;
+                }
+            }
+            winner_ = winners[1];
+        }
+
+        /**
+         * @brief True once every source is exhausted.
+         */
+        bool empty() const { return sources_.empty() || sources_[winner_].empty(); }
+
+        /**
+         * @brief The smallest current head. @pre !empty()
+         */
+        decltype(auto) front() const { return sources_[winner_].front(); }
+
+        /**
+         * @brief Index of the source front() comes from. @pre !empty()
+         */
+        std::size_t winner_source() const noexcept { return winner_; }
+
+        /**
+         * @brief Advances past front() and replays its source's path to the root. @pre !empty()
+         */
+        void pop() {
+            sources_[winner_].pop();
+            std::size_t candidate = winner_;
+            for (std::size_t node = (sources_.size() + winner_) / 2; node >= 1; node /= 2) {
+                if (beats(losers_[node], candidate)) {
+                    std::swap(losers_[node], candidate);
+                }
+            }
+            winner_ = candidate;
+        }
+
+    private:
+        // Exhausted sources lose every match; ties go to the lower index
+        bool beats(std::size_t a, std::size_t b) {
+            if (sources_[a].empty()) return false;
+            if (sources_[b].empty()) return true;
+            return a < b ? !comp_(sources_[b].front(), sources_[a].front())
+                         : static_cast<bool>(comp_(sources_[a].front(), sources_[b].front()));
+        }
+
+        std::vector<Source> sources_;
+        Compare comp_;
+        std::vector<std::size_t> losers_;
+        std::size_t winner_ = 0;
+    };
+
+    /**
+     * @brief Creates a lazy k-way merge over a collection of sorted ranges.
+     *
+     * @tparam Ranges Input range whose elements are sorted ranges, e.g.
+     *   `std::vector<std::vector<T>>` or `std::vector<std::span<const T>>`
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @param inputs The sorted ranges; they must outlive the returned tree
+     * @param comp Comparison function object (defaults to std::less)
+     * @return A LoserTree whose front()/pop() yield the merged sequence
+     *
+     * @par Example:
+     * ```cpp
+     * auto merged = algorithms::sorting::make_kway_merge(segments);
+     * for (; !merged.empty(); merged.pop()) {
+     *     consume(merged.front());
+     * }
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<std::ranges::input_range Ranges, typename Compare = std::less<>>
+        requires std::ranges::input_range<std::ranges::range_reference_t<Ranges>>
+    auto make_kway_merge(Ranges&& inputs, Compare comp = {}) {
+        using InnerRange = std::remove_reference_t<std::ranges::range_reference_t<Ranges>>;
+        using Cursor = detail::RangeCursor<std::ranges::iterator_t<InnerRange>, std::ranges::sentinel_t<InnerRange>>;
+
+        std::vector<Cursor> cursors;
+        for (auto&& input : inputs) {
+            cursors.emplace_back(std::ranges::begin(input), std::ranges::end(input));
+        }
+        return LoserTree<Cursor, Compare>(std::move(cursors), std::move(comp));
+    }
+
+    /**
+     * @brief Merges any number of sorted ranges into an output iterator.
+     *
+     * Replaces chains of two-way merges: all k inputs are merged in one pass with a
+     * loser tree, without any temporary storage besides the O(k) tree itself.
+     *
+     * @tparam Ranges Input range whose elements are sorted ranges
+     * @tparam OutputIt Output iterator type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @param inputs The sorted ranges
+     * @param out Beginning of the destination
+     * @param comp Comparison function object (defaults to std::less)
+     * @return Iterator one past the last element written
+     *
+     * @par Complexity:
+     * - Time: O(n log k) for n elements in total over k ranges
+     * - Space: O(k)
+     *
+     * @par Algorithm Properties:
+     * - Stable: Yes (equal elements keep their order, and ties between ranges go to
+     *   the earlier range)
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<std::vector<int>> shards = {{1, 4, 7}, {2, 5}, {3, 6, 8}};
+     * std::vector<int> merged;
+     * algorithms::sorting::kway_merge(shards, std::back_inserter(merged));
+     * // merged is now {1, 2, 3, 4, 5, 6, 7, 8}
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<std::ranges::input_range Ranges, typename OutputIt, typename Compare = std::less<>>
+        requires std::ranges::input_range<std::ranges::range_reference_t<Ranges>>
+    OutputIt kway_merge(Ranges&& inputs, OutputIt out, Compare comp = {}) {
+        auto merged = make_kway_merge(std::forward<Ranges>(inputs), std::move(comp));
+        for (; !merged.empty(); merged.pop()) {
+            *out = merged.front();
+            ++out;
+        }
+        return out;
+    }
+
+    /** @} */ // end of sorting group
+
+} // namespace sorting
+} // namespace algorithms
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "../utils/allocator.hpp"
+#include "../utils/instrumentation.hpp"
 #include <iterator>
 #include <functional>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace algorithms {
@@ -13,11 +21,41 @@ namespace sorting {
      */
     
     namespace detail {
+        /**
+         * @brief Stably merges two sorted ranges into an output range by moving elements.
+         *
+         * An element of the second range is only taken when it compares strictly less
+         * than the current element of the first range, so on ties the first range wins
+         * and equal elements keep their original relative order. Elements are moved,
+         * never copied, which makes this usable with move-only types; the inputs may
+         * also be std::move_iterator adaptors.
+         *
+         * @return Iterator one past the last element written
+         */
+        template<typename InputIt1, typename InputIt2, typename OutputIt, typename Compare>
+        OutputIt move_merge(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+                            OutputIt out, Compare comp) {
+            while (first1 != last1 && first2 != last2) {
+                if (comp(*first2, *first1)) {
+                    *out = std::move(*first2);
+                    ++first2;
+                } else {
+                    *out = std::move(*first1);
+                    ++first1;
+                }
+                ++out;
+            }
+            out = std::move(first1, last1, out);
+            return std::move(first2, last2, out);
+        }
+
         /**
          * @brief Merges two sorted ranges into one sorted range.
          * 
          * Helper function that merges two consecutive sorted ranges [first, mid) and [mid, last)
          * into a single sorted range [first, last). Uses temporary storage for the merge operation.
+         * Elements are moved into the temporary storage and back, and ties are resolved in
+         * favor of [first, mid), so the merge is stable and accepts move-only types.
          * 
          * @tparam RandomIt Random access iterator type
          * @tparam Compare Comparison function type
@@ -26,48 +64,124 @@ namespace sorting {
          * @param last End of second sorted range
          * @param comp Comparison function
          * 
+         * @param instrumentation Told about the temporary buffer and the element moves
+         * @param alloc Allocator for the temporary buffer
+         * 
          * @pre [first, mid) and [mid, last) must be sorted according to comp
-         * @post [first, last) is sorted according to comp
+         * @post [first, last) is sorted according to comp, with equal elements in their
+         *   original relative order
          */
-        template<typename RandomIt, typename Compare>
-        void merge(RandomIt first, RandomIt mid, RandomIt last, Compare comp) {
+        template<typename RandomIt, typename Compare, typename Instr = utils::NoInstrumentation,
+                 typename Allocator = std::allocator<typename std::iterator_traits<RandomIt>::value_type>>
+        void merge(RandomIt first, RandomIt mid, RandomIt last, Compare comp, Instr&& instrumentation = Instr{},
+                   const Allocator& alloc = Allocator()) {
             using ValueType = typename std::iterator_traits<RandomIt>::value_type;
             
             // Create temporary storage for the merge
-            std::vector<ValueType> temp;
+            std::vector<ValueType, utils::RebindAlloc<Allocator, ValueType>> temp(alloc);
             temp.reserve(std::distance(first, last));
+            instrumentation.count_allocations(1);
+            // Every element moves into temp and back
+            instrumentation.count_moves(2 * static_cast<std::uint64_t>(std::distance(first, last)));
             
-            auto left = first;
-            auto right = mid;
+            move_merge(first, mid, mid, last, std::back_inserter(temp), comp);
             
-            // Merge the two sorted ranges
-            while (left != mid && right != last) {
-                if (comp(*left, *right)) {
-                    temp.push_back(*left);
-                    ++left;
+            // Move merged result back to original range
+            std::move(temp.begin(), temp.end(), first);
+        }
+
+        /**
+         * @brief Top-down merge sort recursion, reporting its buffers and moves to instrumentation.
+         */
+        template<typename RandomIt, typename Compare, typename Instr,
+                 typename Allocator = std::allocator<typename std::iterator_traits<RandomIt>::value_type>>
+        void merge_sort_recursive(RandomIt first, RandomIt last, Compare& comp, Instr& instrumentation,
+                                  const Allocator& alloc = Allocator()) {
+            auto distance = std::distance(first, last);
+            if (distance <= 1) return;  // Base case: 0 or 1 element
+            
+            auto mid = std::next(first, distance / 2);
+            
+            // Recursively sort both halves
+            merge_sort_recursive(first, mid, comp, instrumentation, alloc);
+            merge_sort_recursive(mid, last, comp, instrumentation, alloc);
+            
+            // Merge the sorted halves
+            detail::merge(first, mid, last, std::ref(comp), instrumentation, alloc);
+        }
+
+        /**
+         * @brief Runs shorter than this are sorted by insertion sort before merging.
+         */
+        inline constexpr std::ptrdiff_t insertion_sort_threshold = 32;
+
+        /**
+         * @brief Stable insertion sort that moves elements instead of copying them.
+         * @tparam RandomIt Random access iterator type
+         * @tparam Compare Comparison function type
+         * @param first Beginning of the range
+         * @param last End of the range
+         * @param comp Comparison function
+         */
+        template<typename RandomIt, typename Compare>
+        void insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+            if (first == last) return;
+            for (auto it = std::next(first); it != last; ++it) {
+                auto value = std::move(*it);
+                auto hole = it;
+                while (hole != first && comp(value, *std::prev(hole))) {
+                    *hole = std::move(*std::prev(hole));
+                    --hole;
+                }
+                *hole = std::move(value);
+            }
+        }
+
+        /**
+         * @brief One bottom-up pass: merges adjacent runs of `width` from src into dst.
+         */
+        template<typename SrcIt, typename DstIt, typename Compare>
+        void merge_pass(SrcIt src, DstIt dst, std::ptrdiff_t size, std::ptrdiff_t width, Compare comp) {
+            for (std::ptrdiff_t begin = 0; begin < size; begin += 2 * width) {
+                const auto mid = std::min(begin + width, size);
+                const auto end = std::min(begin + 2 * width, size);
+                move_merge(src + begin, src + mid, src + mid, src + end, dst + begin, comp);
+            }
+        }
+
+        /**
+         * @brief Bottom-up merge sort of [first, first + size) ping-ponging with buffer.
+         * @param data_in_buffer True if the elements to sort currently live in buffer
+         *   rather than in the input range; the result always ends up in the input range.
+         * @pre buffer points to at least size live, move-assignable elements
+         */
+        template<typename RandomIt, typename BufferIt, typename Compare>
+        void bottom_up_merge_sort(RandomIt first, std::ptrdiff_t size, BufferIt buffer,
+                                  bool data_in_buffer, Compare comp) {
+            for (std::ptrdiff_t begin = 0; begin < size; begin += insertion_sort_threshold) {
+                const auto end = std::min(begin + insertion_sort_threshold, size);
+                if (data_in_buffer) {
+                    insertion_sort(buffer + begin, buffer + end, comp);
                 } else {
-                    temp.push_back(*right);
-                    ++right;
+                    insertion_sort(first + begin, first + end, comp);
                 }
             }
-            
-            // Copy remaining elements from left range
-            while (left != mid) {
-                temp.push_back(*left);
-                ++left;
+
+            for (std::ptrdiff_t width = insertion_sort_threshold; width < size; width *= 2) {
+                if (data_in_buffer) {
+                    merge_pass(buffer, first, size, width, comp);
+                } else {
+                    merge_pass(first, buffer, size, width, comp);
+                }
+                data_in_buffer = !data_in_buffer;
             }
-            
-            // Copy remaining elements from right range
-            while (right != last) {
-                temp.push_back(*right);
-                ++right;
+
+            if (data_in_buffer) {
+                std::move(buffer, buffer + size, first);
             }
-            
-            // Copy merged result back to original range
-            std::copy(temp.begin(), temp.end(), first);
         }
     }
-    
+
     /**
      * @brief Sorts a range of elements using the merge sort algorithm.
      * 
@@ -77,7 +191,8 @@ namespace sorting {
      * 
      * @tparam RandomIt Random access iterator type that must provide:
      *   - Random access capabilities (arithmetic operations)
-     *   - Value type must be copy constructible and comparable using Compare function
+     *   - Value type must be move constructible, move assignable and comparable using
+     *     Compare function; move-only types such as std::unique_ptr are supported
      * @tparam Compare Comparison function type compatible with `bool(T, T)`
      * 
      * @param first Iterator to the beginning of the range to sort
@@ -111,17 +226,209 @@ namespace sorting {
                                        typename std::iterator_traits<RandomIt>::iterator_category>,
                       "Iterator must be a random access iterator for merge sort.");
         
-        auto distance = std::distance(first, last);
-        if (distance <= 1) return;  // Base case: 0 or 1 element
-        
-        auto mid = std::next(first, distance / 2);
+        utils::NoInstrumentation instrumentation;
+        detail::merge_sort_recursive(first, last, comp, instrumentation);
+    }
+
+    /**
+     * @brief Sorts a range with merge sort and reports its operation counts.
+     * 
+     * Same algorithm and result as the overload without instrumentation. Every call of
+     * comp is counted as a comparison, every temporary buffer as an allocation, and
+     * every element moved into one and back as two moves; finish("merge_sort") is
+     * called once the range is sorted. With utils::NoInstrumentation this compiles to
+     * the plain overload.
+     * 
+     * @tparam RandomIt Random access iterator type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * @tparam Instr Type satisfying utils::Instrumentation
+     * 
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object
+     * @param instrumentation Receives the counts of this call
+     * 
+     * @par Example:
+     * ```cpp
+     * algorithms::utils::CountingInstrumentation metrics(report_to_pipeline);
+     * algorithms::sorting::merge_sort(data.begin(), data.end(), std::less<>{}, metrics);
+     * ```
+     * 
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare, utils::Instrumentation Instr>
+    void merge_sort(RandomIt first, RandomIt last, Compare comp, Instr& instrumentation) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
         
-        // Recursively sort both halves
-        merge_sort(first, mid, comp);
-        merge_sort(mid, last, comp);
+        auto counted = utils::counting_compare(comp, instrumentation);
+        detail::merge_sort_recursive(first, last, counted, instrumentation);
+        instrumentation.finish("merge_sort");
+    }
+
+    /**
+     * @brief Sorts a range with merge sort, allocating its temporary buffers with alloc.
+     * 
+     * Same algorithm and result as the overload without an allocator. Each merge
+     * allocates and frees one buffer, for O(n log n) bytes in total; with a monotonic
+     * arena, which never reuses freed memory, prefer merge_sort_bottom_up, which
+     * allocates a single buffer of n elements.
+     * 
+     * @tparam RandomIt Random access iterator type
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * @tparam Allocator Type satisfying utils::SimpleAllocator; rebound to the value type
+     * 
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object
+     * @param alloc Allocator for the temporary buffers
+     * 
+     * @par Example:
+     * ```cpp
+     * std::pmr::unsynchronized_pool_resource pool;
+     * algorithms::sorting::merge_sort(data.begin(), data.end(), std::less<>{}, std::pmr::polymorphic_allocator<>(&pool));
+     * ```
+     * 
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare, utils::SimpleAllocator Allocator>
+    void merge_sort(RandomIt first, RandomIt last, Compare comp, const Allocator& alloc) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
         
-        // Merge the sorted halves
-        detail::merge(first, mid, last, comp);
+        utils::NoInstrumentation instrumentation;
+        detail::merge_sort_recursive(first, last, comp, instrumentation, alloc);
+    }
+
+    /**
+     * @brief Sorts a range with an iterative bottom-up merge sort and a single buffer.
+     * 
+     * Instead of allocating a temporary vector for every merge, this variant sorts runs
+     * of 32 elements with insertion sort, then merges runs of doubling width, moving
+     * elements back and forth between the input range and one auxiliary buffer of n
+     * elements allocated up front. Elements are only ever moved, never copied.
+     * 
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * 
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object (defaults to std::less)
+     * 
+     * @par Complexity:
+     * - Time: O(n log n) in all cases
+     * - Space: O(n) for the single auxiliary buffer
+     * 
+     * @par Algorithm Properties:
+     * - Stable: Yes (equal elements maintain relative order)
+     * - Allocations: exactly one, for the buffer
+     * 
+     * @par Example:
+     * ```cpp
+     * std::vector<std::string> names = {"carol", "alice", "bob"};
+     * algorithms::sorting::merge_sort_bottom_up(names.begin(), names.end());
+     * // names is now {"alice", "bob", "carol"}
+     * ```
+     * 
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare = std::less<>>
+    void merge_sort_bottom_up(RandomIt first, RandomIt last, Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+
+        // Moving the input into the buffer gives both sides n live elements to move-assign into
+        std::vector<ValueType> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+        detail::bottom_up_merge_sort(first, size, buffer.begin(), true, comp);
+    }
+
+    /**
+     * @brief Sorts a range with a bottom-up merge sort, allocating its buffer with alloc.
+     * 
+     * Same algorithm as the overload without an allocator; its one buffer of n
+     * elements comes from alloc, which suits per-request monotonic arenas.
+     * 
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * @tparam Allocator Type satisfying utils::SimpleAllocator; rebound to the value type
+     * 
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object
+     * @param alloc Allocator for the buffer
+     * 
+     * @par Example:
+     * ```cpp
+     * std::pmr::monotonic_buffer_resource arena;
+     * algorithms::sorting::merge_sort_bottom_up(rows.begin(), rows.end(), by_key, std::pmr::polymorphic_allocator<>(&arena));
+     * ```
+     * 
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare, utils::SimpleAllocator Allocator>
+    void merge_sort_bottom_up(RandomIt first, RandomIt last, Compare comp, const Allocator& alloc) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+
+        std::vector<ValueType, utils::RebindAlloc<Allocator, ValueType>> buffer(
+            std::make_move_iterator(first), std::make_move_iterator(last), alloc);
+        detail::bottom_up_merge_sort(first, size, buffer.begin(), true, comp);
+    }
+
+    /**
+     * @brief Sorts a range with a bottom-up merge sort using a caller-supplied buffer.
+     * 
+     * Same algorithm as the overload without a buffer, but performs no allocation at
+     * all, so a buffer can be reused across many sorts.
+     * 
+     * @tparam RandomIt Random access iterator type; value type must be move assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     * 
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object
+     * @param buffer Scratch storage of at least `last - first` live elements; its
+     *   contents are overwritten with moved-from values
+     * @throws std::invalid_argument If the buffer is smaller than the range
+     * 
+     * @par Example:
+     * ```cpp
+     * std::vector<Record> scratch(batch_size);
+     * for (auto& batch : batches) {
+     *     algorithms::sorting::merge_sort_bottom_up(batch.begin(), batch.end(), std::less<>{}, std::span(scratch));
+     * }
+     * ```
+     * 
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare>
+    void merge_sort_bottom_up(RandomIt first, RandomIt last, Compare comp,
+                              std::span<typename std::iterator_traits<RandomIt>::value_type> buffer) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+        if (buffer.size() < static_cast<std::size_t>(size)) {
+            throw std::invalid_argument("buffer must hold at least as many elements as the range");
+        }
+
+        detail::bottom_up_merge_sort(first, size, buffer.begin(), false, comp);
     }
 
     /** @} */ // end of sorting group
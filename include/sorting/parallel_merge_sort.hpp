@@ -0,0 +1,216 @@
+#pragma once
+
+#include "merge_sort.hpp"
+#include "../utils/parallel.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace sorting {
+    /**
+     * @addtogroup sorting
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Ranges shorter than this are sorted on a single thread.
+         */
+        inline constexpr std::ptrdiff_t parallel_sort_cutoff = std::ptrdiff_t{1} << 14;
+
+        /**
+         * @brief Finds how many of the first k merged elements come from the left run.
+         *
+         * Binary search along the merge path of [left, left + left_size) and
+         * [right, right + right_size): returns the smallest i such that the element
+         * `left[i]` is ordered after `right[k - i - 1]`. Ties go to the left run, so
+         * splitting a merge at these points yields exactly the stable merge.
+         */
+        template<typename LeftIt, typename RightIt, typename Compare>
+        std::ptrdiff_t merge_path_split(LeftIt left, std::ptrdiff_t left_size,
+                                        RightIt right, std::ptrdiff_t right_size,
+                                        std::ptrdiff_t k, Compare& comp) {
+            std::ptrdiff_t lo = std::max<std::ptrdiff_t>(0, k - right_size);
+            std::ptrdiff_t hi = std::min(k, left_size);
+            while (lo < hi) {
+                const std::ptrdiff_t i = lo + (hi - lo) / 2;
+                if (comp(right[k - i - 1], left[i])) {
+                    hi = i;
+                } else {
+                    lo = i + 1;
+                }
+            }
+            return lo;
+        }
+
+        /**
+         * @brief Stable merge of two sorted runs into out, split across thread_count threads.
+         *
+         * The output is cut into equal slices; each slice boundary is mapped back to
+         * the two inputs with merge_path_split, after which every thread merges its
+         * slice independently.
+         */
+        template<typename LeftIt, typename RightIt, typename OutputIt, typename Compare>
+        void parallel_move_merge(LeftIt left, std::ptrdiff_t left_size, RightIt right, std::ptrdiff_t right_size,
+                                 OutputIt out, std::size_t thread_count, Compare& comp) {
+            const std::ptrdiff_t total = left_size + right_size;
+            const auto parts = static_cast<std::ptrdiff_t>(thread_count);
+
+            // All splits are found before any thread starts moving elements out of the inputs
+            std::vector<std::ptrdiff_t> splits(thread_count + 1);
+            for (std::ptrdiff_t part = 0; part <= parts; ++part) {
+                splits[static_cast<std::size_t>(part)] =
+                    merge_path_split(left, left_size, right, right_size, total * part / parts, comp);
+            }
+
+            utils::run_parallel(thread_count, [&](std::size_t part) {
+                const std::ptrdiff_t k_begin = total * static_cast<std::ptrdiff_t>(part) / parts;
+                const std::ptrdiff_t k_end = total * (static_cast<std::ptrdiff_t>(part) + 1) / parts;
+                const std::ptrdiff_t i_begin = splits[part];
+                const std::ptrdiff_t i_end = splits[part + 1];
+                move_merge(left + i_begin, left + i_end,
+                           right + (k_begin - i_begin), right + (k_end - i_end),
+                           out + k_begin, comp);
+            });
+        }
+
+        /**
+         * @brief Fork-join merge sort of [first, first + size) using buffer as scratch.
+         *
+         * Both halves are sorted concurrently, each with its share of the thread budget,
+         * until the budget reaches one thread or the range drops below the cutoff, where
+         * the serial bottom-up merge sort takes over. The halves are then merged into
+         * the buffer in parallel and moved back.
+         */
+        template<typename RandomIt, typename BufferIt, typename Compare>
+        void parallel_merge_sort(RandomIt first, std::ptrdiff_t size, BufferIt buffer,
+                                 std::size_t thread_count, Compare& comp) {
+            if (thread_count <= 1 || size < parallel_sort_cutoff) {
+                bottom_up_merge_sort(first, size, buffer, false, comp);
+                return;
+            }
+
+            // Split proportionally to the threads given to each half
+            const std::size_t left_threads = thread_count / 2;
+            const std::size_t right_threads = thread_count - left_threads;
+            const std::ptrdiff_t mid = size * static_cast<std::ptrdiff_t>(left_threads)
+                                            / static_cast<std::ptrdiff_t>(thread_count);
+
+            utils::run_parallel(2, [&](std::size_t half) {
+                if (half == 0) {
+                    parallel_merge_sort(first + mid, size - mid, buffer + mid, right_threads, comp);
+                } else {
+                    parallel_merge_sort(first, mid, buffer, left_threads, comp);
+                }
+            });
+
+            parallel_move_merge(first, mid, first + mid, size - mid, buffer, thread_count, comp);
+
+            utils::parallel_for_chunks(thread_count, static_cast<std::size_t>(size),
+                                       static_cast<std::size_t>(size) / thread_count + 1,
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    const auto b = static_cast<std::ptrdiff_t>(begin);
+                    const auto e = static_cast<std::ptrdiff_t>(end);
+                    std::move(buffer + b, buffer + e, first + b);
+                });
+        }
+    }
+
+    /**
+     * @brief Sorts a range with merge sort on several threads.
+     *
+     * The range is recursively split and both halves are sorted concurrently, each
+     * with half of the thread budget. Once a subrange has a single thread or fewer
+     * than 16384 elements, it is sorted by the serial bottom-up merge sort. Large
+     * merges are themselves split across threads by binary search along the merge
+     * path, so the last merges do not serialize on one core.
+     *
+     * All threads share one auxiliary buffer of n elements allocated up front.
+     *
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`; it is
+     *   called concurrently and must be safe to do so
+     *
+     * @param policy Number of threads to use
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object (defaults to std::less)
+     *
+     * @par Complexity:
+     * - Time: O(n log n) work, O(n log n / p + n) span with p threads
+     * - Space: O(n) for the shared buffer
+     *
+     * @par Algorithm Properties:
+     * - Stable: Yes (equal elements maintain relative order)
+     * - Result is identical to the serial merge sort
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{64}, rows.begin(), rows.end(), by_key);
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare = std::less<>>
+    void merge_sort(const utils::ParallelPolicy& policy, RandomIt first, RandomIt last, Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+
+        // Moving the input through the buffer gives it n live elements to move-assign into
+        std::vector<ValueType> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+        std::move(buffer.begin(), buffer.end(), first);
+        detail::parallel_merge_sort(first, size, buffer.begin(), policy.resolved_thread_count(), comp);
+    }
+
+    /**
+     * @brief Sorts a range with merge sort on several threads, allocating the shared buffer with alloc.
+     *
+     * Same algorithm and result as the overload without an allocator. The one buffer
+     * of n elements is allocated by the calling thread before any worker starts, so
+     * alloc need not be thread-safe.
+     *
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`; it is
+     *   called concurrently and must be safe to do so
+     * @tparam Allocator Type satisfying utils::SimpleAllocator; rebound to the value type
+     *
+     * @param policy Number of threads to use
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object
+     * @param alloc Allocator for the shared buffer
+     *
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare, utils::SimpleAllocator Allocator>
+    void merge_sort(const utils::ParallelPolicy& policy, RandomIt first, RandomIt last, Compare comp,
+                    const Allocator& alloc) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for merge sort.");
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+
+        std::vector<ValueType, utils::RebindAlloc<Allocator, ValueType>> buffer(
+            std::make_move_iterator(first), std::make_move_iterator(last), alloc);
+        std::move(buffer.begin(), buffer.end(), first);
+        detail::parallel_merge_sort(first, size, buffer.begin(), policy.resolved_thread_count(), comp);
+    }
+
+    /** @} */ // end of sorting group
+
+} // namespace sorting
+} // namespace algorithms
@@ -0,0 +1,470 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace algorithms {
+namespace sorting {
+    /**
+     * @addtogroup sorting
+     * @{
+     */
+
+    namespace detail {
+        /**
+         * @brief Partitions shorter than this are finished with insertion sort.
+         */
+        inline constexpr std::ptrdiff_t pdq_insertion_threshold = 24;
+
+        /**
+         * @brief Partitions longer than this choose their pivot as a pseudomedian of nine.
+         */
+        inline constexpr std::ptrdiff_t pdq_ninther_threshold = 128;
+
+        /**
+         * @brief Element moves after which the optimistic insertion sort gives up.
+         */
+        inline constexpr std::ptrdiff_t pdq_partial_insertion_limit = 8;
+
+        /**
+         * @brief Elements classified per block by the branchless partition.
+         */
+        inline constexpr std::ptrdiff_t pdq_block_size = 64;
+
+        /**
+         * @brief True if comparisons can be evaluated without branches.
+         *
+         * Arithmetic values under the standard ordering functors compare in one
+         * instruction whose result can be used as an integer, which is what the block
+         * partition relies on. Any other comparator takes the classic partition.
+         */
+        template<typename T, typename Compare>
+        inline constexpr bool pdq_branchless =
+            std::is_arithmetic_v<T> &&
+            (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>> ||
+             std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>);
+
+        /**
+         * @brief Insertion sort of [first, last).
+         */
+        template<typename RandomIt, typename Compare>
+        void pdq_insertion_sort(RandomIt first, RandomIt last, Compare& comp) {
+            if (first == last) return;
+            for (auto it = first + 1; it != last; ++it) {
+                auto hole = it;
+                if (comp(*hole, *(hole - 1))) {
+                    auto value = std::move(*hole);
+                    do {
+                        *hole = std::move(*(hole - 1));
+                        --hole;
+                    } while (hole != first && comp(value, *(hole - 1)));
+                    *hole = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * @brief Insertion sort without a bounds check on the left.
+         * @pre `*(first - 1)` is not greater than any element of [first, last)
+         */
+        template<typename RandomIt, typename Compare>
+        void pdq_unguarded_insertion_sort(RandomIt first, RandomIt last, Compare& comp) {
+            if (first == last) return;
+            for (auto it = first + 1; it != last; ++it) {
+                auto hole = it;
+                if (comp(*hole, *(hole - 1))) {
+                    auto value = std::move(*hole);
+                    do {
+                        *hole = std::move(*(hole - 1));
+                        --hole;
+                    } while (comp(value, *(hole - 1)));
+                    *hole = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * @brief Insertion sort that gives up once it has moved too many elements.
+         * @return True if [first, last) ended up sorted
+         */
+        template<typename RandomIt, typename Compare>
+        bool pdq_partial_insertion_sort(RandomIt first, RandomIt last, Compare& comp) {
+            if (first == last) return true;
+            std::ptrdiff_t moves = 0;
+            for (auto it = first + 1; it != last; ++it) {
+                auto hole = it;
+                if (comp(*hole, *(hole - 1))) {
+                    auto value = std::move(*hole);
+                    do {
+                        *hole = std::move(*(hole - 1));
+                        --hole;
+                    } while (hole != first && comp(value, *(hole - 1)));
+                    *hole = std::move(value);
+                    moves += it - hole;
+                }
+                if (moves > pdq_partial_insertion_limit) return false;
+            }
+            return true;
+        }
+
+        template<typename RandomIt, typename Compare>
+        void pdq_sort2(RandomIt a, RandomIt b, Compare& comp) {
+            if (comp(*b, *a)) std::iter_swap(a, b);
+        }
+
+        template<typename RandomIt, typename Compare>
+        void pdq_sort3(RandomIt a, RandomIt b, RandomIt c, Compare& comp) {
+            pdq_sort2(a, b, comp);
+            pdq_sort2(b, c, comp);
+            pdq_sort2(a, b, comp);
+        }
+
+        /**
+         * @brief Partitions [first, last) around the pivot *first into less and not less.
+         *
+         * Elements equal to the pivot go to the right. The pivot must be a median of at
+         * least three elements, so that both scans are guarded by a sentinel.
+         *
+         * @return The pivot's final position, and whether no element had to be swapped
+         */
+        template<typename RandomIt, typename Compare>
+        std::pair<RandomIt, bool> pdq_partition_right(RandomIt first, RandomIt last, Compare& comp) {
+            auto pivot = std::move(*first);
+            auto left = first;
+            auto right = last;
+
+            while (comp(*++left, pivot)) {}
+            if (left - 1 == first) {
+                while (left < right && !comp(*--right, pivot)) {}
+            } else {
+                while (!comp(*--right, pivot)) {}
+            }
+
+            const bool already_partitioned = left >= right;
+            while (left < right) {
+                std::iter_swap(left, right);
+                while (comp(*++left, pivot)) {}
+                while (!comp(*--right, pivot)) {}
+            }
+
+            auto pivot_pos = left - 1;
+            *first = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        /**
+         * @brief Swaps the misplaced elements recorded in two offset blocks.
+         *
+         * With unequal counts a cyclic permutation of moves replaces the swaps, which
+         * costs one move per element instead of three.
+         */
+        template<typename RandomIt>
+        void pdq_swap_offsets(RandomIt left_base, RandomIt right_base,
+                              const unsigned char* left_offsets, const unsigned char* right_offsets,
+                              std::ptrdiff_t count, bool use_swaps) {
+            if (use_swaps) {
+                for (std::ptrdiff_t i = 0; i < count; ++i) {
+                    std::iter_swap(left_base + left_offsets[i], right_base - right_offsets[i]);
+                }
+            } else if (count > 0) {
+                auto l = left_base + left_offsets[0];
+                auto r = right_base - right_offsets[0];
+                auto value = std::move(*l);
+                *l = std::move(*r);
+                for (std::ptrdiff_t i = 1; i < count; ++i) {
+                    l = left_base + left_offsets[i];
+                    *r = std::move(*l);
+                    r = right_base - right_offsets[i];
+                    *l = std::move(*r);
+                }
+                *r = std::move(value);
+            }
+        }
+
+        /**
+         * @brief Block partition with the same contract as pdq_partition_right.
+         *
+         * Elements are classified a block at a time: the index of every element on the
+         * wrong side is written to an offset buffer unconditionally and the buffer's
+         * length advances by the comparison result, so the classification loop has no
+         * data-dependent branch to mispredict. Misplaced elements are then swapped in
+         * pairs from the two buffers.
+         */
+        template<typename RandomIt, typename Compare>
+        std::pair<RandomIt, bool> pdq_partition_right_branchless(RandomIt first, RandomIt last, Compare& comp) {
+            auto pivot = std::move(*first);
+            auto left = first;
+            auto right = last;
+
+            while (comp(*++left, pivot)) {}
+            if (left - 1 == first) {
+                while (left < right && !comp(*--right, pivot)) {}
+            } else {
+                while (!comp(*--right, pivot)) {}
+            }
+
+            const bool already_partitioned = left >= right;
+            if (!already_partitioned) {
+                std::iter_swap(left, right);
+                ++left;
+
+                alignas(64) unsigned char left_offsets[pdq_block_size];
+                alignas(64) unsigned char right_offsets[pdq_block_size];
+                auto left_base = left;
+                auto right_base = right;
+                std::ptrdiff_t left_count = 0, right_count = 0, left_start = 0, right_start = 0;
+
+                while (left < right) {
+                    // Split the unknown middle between the blocks that need refilling
+                    const std::ptrdiff_t unknown = right - left;
+                    const std::ptrdiff_t left_split = left_count == 0 ? (right_count == 0 ? unknown / 2 : unknown) : 0;
+                    const std::ptrdiff_t right_split = right_count == 0 ? unknown - left_split : 0;
+
+                    const std::ptrdiff_t left_block = std::min(left_split, pdq_block_size);
+                    for (std::ptrdiff_t i = 0; i < left_block; ++i) {
+                        left_offsets[left_count] = static_cast<unsigned char>(i);
+                        left_count += !comp(*left, pivot);
+                        ++left;
+                    }
+
+                    const std::ptrdiff_t right_block = std::min(right_split, pdq_block_size);
+                    for (std::ptrdiff_t i = 0; i < right_block;) {
+                        right_offsets[right_count] = static_cast<unsigned char>(++i);
+                        right_count += comp(*--right, pivot);
+                    }
+
+                    const std::ptrdiff_t count = std::min(left_count, right_count);
+                    pdq_swap_offsets(left_base, right_base, left_offsets + left_start, right_offsets + right_start,
+                                     count, left_count == right_count);
+                    left_count -= count;
+                    right_count -= count;
+                    left_start += count;
+                    right_start += count;
+                    if (left_count == 0) {
+                        left_start = 0;
+                        left_base = left;
+                    }
+                    if (right_count == 0) {
+                        right_start = 0;
+                        right_base = right;
+                    }
+                }
+
+                // At most one block still holds misplaced elements; move them to the boundary
+                if (left_count > 0) {
+                    while (left_count-- > 0) {
+                        std::iter_swap(left_base + left_offsets[left_start + left_count], --right);
+                    }
+                    left = right;
+                }
+                if (right_count > 0) {
+                    while (right_count-- > 0) {
+                        std::iter_swap(right_base - right_offsets[right_start + right_count], left);
+                        ++left;
+                    }
+                }
+            }
+
+            auto pivot_pos = left - 1;
+            *first = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        /**
+         * @brief Partitions [first, last) around *first into not greater and greater.
+         *
+         * Used when the pivot equals the element just left of the range, which is then
+         * known to be the smallest value present: everything equal to the pivot is put
+         * in place at once, so inputs with many duplicates take linear time.
+         *
+         * @return The pivot's final position
+         */
+        template<typename RandomIt, typename Compare>
+        RandomIt pdq_partition_left(RandomIt first, RandomIt last, Compare& comp) {
+            auto pivot = std::move(*first);
+            auto left = first;
+            auto right = last;
+
+            while (comp(pivot, *--right)) {}
+            if (right + 1 == last) {
+                while (left < right && !comp(pivot, *++left)) {}
+            } else {
+                while (!comp(pivot, *++left)) {}
+            }
+
+            while (left < right) {
+                std::iter_swap(left, right);
+                while (comp(pivot, *--right)) {}
+                while (!comp(pivot, *++left)) {}
+            }
+
+            auto pivot_pos = right;
+            *first = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return pivot_pos;
+        }
+
+        /**
+         * @brief Pattern-defeating quicksort main loop.
+         * @param bad_allowed Highly unbalanced partitions tolerated before switching to heapsort
+         * @param leftmost True if no element lies left of first, so insertion sort must be guarded
+         */
+        template<bool Branchless, typename RandomIt, typename Compare>
+        void pdq_sort_loop(RandomIt first, RandomIt last, Compare& comp, int bad_allowed, bool leftmost) {
+            while (true) {
+                const std::ptrdiff_t size = last - first;
+                if (size < pdq_insertion_threshold) {
+                    if (leftmost) {
+                        pdq_insertion_sort(first, last, comp);
+                    } else {
+                        pdq_unguarded_insertion_sort(first, last, comp);
+                    }
+                    return;
+                }
+
+                // Move the chosen pivot to *first
+                const std::ptrdiff_t half = size / 2;
+                if (size > pdq_ninther_threshold) {
+                    pdq_sort3(first, first + half, last - 1, comp);
+                    pdq_sort3(first + 1, first + (half - 1), last - 2, comp);
+                    pdq_sort3(first + 2, first + (half + 1), last - 3, comp);
+                    pdq_sort3(first + (half - 1), first + half, first + (half + 1), comp);
+                    std::iter_swap(first, first + half);
+                } else {
+                    pdq_sort3(first + half, first, last - 1, comp);
+                }
+
+                // A pivot equal to the preceding element means this range has many copies of it
+                if (!leftmost && !comp(*(first - 1), *first)) {
+                    first = pdq_partition_left(first, last, comp) + 1;
+                    continue;
+                }
+
+                const auto [pivot_pos, already_partitioned] = Branchless
+                    ? pdq_partition_right_branchless(first, last, comp)
+                    : pdq_partition_right(first, last, comp);
+
+                const std::ptrdiff_t left_size = pivot_pos - first;
+                const std::ptrdiff_t right_size = last - (pivot_pos + 1);
+
+                if (left_size < size / 8 || right_size < size / 8) {
+                    if (--bad_allowed == 0) {
+                        std::make_heap(first, last, comp);
+                        std::sort_heap(first, last, comp);
+                        return;
+                    }
+
+                    // Shuffle a few elements to break the pattern that produced the bad pivot
+                    if (left_size >= pdq_insertion_threshold) {
+                        std::iter_swap(first, first + left_size / 4);
+                        std::iter_swap(pivot_pos - 1, pivot_pos - left_size / 4);
+                        if (left_size > pdq_ninther_threshold) {
+                            std::iter_swap(first + 1, first + (left_size / 4 + 1));
+                            std::iter_swap(first + 2, first + (left_size / 4 + 2));
+                            std::iter_swap(pivot_pos - 2, pivot_pos - (left_size / 4 + 1));
+                            std::iter_swap(pivot_pos - 3, pivot_pos - (left_size / 4 + 2));
+                        }
+                    }
+                    if (right_size >= pdq_insertion_threshold) {
+                        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + right_size / 4));
+                        std::iter_swap(last - 1, last - right_size / 4);
+                        if (right_size > pdq_ninther_threshold) {
+                            std::iter_swap(pivot_pos + 2, pivot_pos + (2 + right_size / 4));
+                            std::iter_swap(pivot_pos + 3, pivot_pos + (3 + right_size / 4));
+                            std::iter_swap(last - 2, last - (1 + right_size / 4));
+                            std::iter_swap(last - 3, last - (2 + right_size / 4));
+                        }
+                    }
+                } else if (already_partitioned &&
+                           pdq_partial_insertion_sort(first, pivot_pos, comp) &&
+                           pdq_partial_insertion_sort(pivot_pos + 1, last, comp)) {
+                    // A balanced partition that needed no swaps hints at sorted input
+                    return;
+                }
+
+                // Recurse into the left part and loop on the right one
+                pdq_sort_loop<Branchless>(first, pivot_pos, comp, bad_allowed, leftmost);
+                first = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Sorts a range with pattern-defeating quicksort (unstable).
+     *
+     * An introsort-style quicksort that adapts to its input:
+     * - already sorted and reverse-sorted ranges are detected up front and finished in
+     *   a single linear pass (a reverse-sorted range is reversed in place);
+     * - pivots are a median of three, or a pseudomedian of nine on large partitions;
+     * - partitions that split badly trigger a small shuffle to break adversarial
+     *   patterns, and after about log2(n) of them the range is heapsorted, which
+     *   bounds the worst case at O(n log n);
+     * - runs of elements equal to an earlier pivot are put in place in one pass;
+     * - for arithmetic types under std::less or std::greater, partitioning classifies
+     *   elements in blocks without data-dependent branches.
+     *
+     * @tparam RandomIt Random access iterator type; value type must be move constructible,
+     *   move assignable and swappable
+     * @tparam Compare Comparison function type compatible with `bool(T, T)`
+     *
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param comp Comparison function object (defaults to std::less)
+     *
+     * @par Complexity:
+     * - Time: O(n log n) worst case, O(n) for sorted, reverse-sorted or few distinct values
+     * - Space: O(log n) stack
+     *
+     * @par Algorithm Properties:
+     * - Stable: No (use merge_sort when equal elements must keep their order)
+     * - In-place: Yes (no allocation)
+     * - Adaptive: Yes
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<int> data = {64, 34, 25, 12, 22, 11, 90};
+     * algorithms::sorting::pdq_sort(data.begin(), data.end());
+     * // data is now {11, 12, 22, 25, 34, 64, 90}
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Compare = std::less<>>
+    void pdq_sort(RandomIt first, RandomIt last, Compare comp = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for pdq sort.");
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+        const auto size = std::distance(first, last);
+        if (size <= 1) return;
+
+        // Sorted and reverse-sorted fast paths; random input bails out within a few elements
+        auto run_end = first + 1;
+        if (comp(*run_end, *first)) {
+            while (run_end != last && comp(*run_end, *(run_end - 1))) ++run_end;
+            if (run_end == last) {
+                std::reverse(first, last);
+                return;
+            }
+        } else {
+            while (run_end != last && !comp(*run_end, *(run_end - 1))) ++run_end;
+            if (run_end == last) return;
+        }
+
+        const int bad_allowed = static_cast<int>(std::bit_width(static_cast<std::size_t>(size)));
+        detail::pdq_sort_loop<detail::pdq_branchless<ValueType, Compare>>(first, last, comp, bad_allowed, true);
+    }
+
+    /** @} */ // end of sorting group
+
+} // namespace sorting
+} // namespace algorithms
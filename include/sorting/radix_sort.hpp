@@ -0,0 +1,248 @@
+#pragma once
+
+#include "../utils/allocator.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+namespace sorting {
+    /**
+     * @addtogroup sorting
+     * @{
+     */
+
+    /**
+     * @brief Key types radix_sort can order by their bit pattern.
+     *
+     * Integers other than bool, and IEEE 754 single and double precision floats.
+     *
+     * @ingroup sorting
+     */
+    template<typename T>
+    concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) ||
+                       (std::floating_point<T> && std::numeric_limits<T>::is_iec559 &&
+                        (sizeof(T) == 4 || sizeof(T) == 8));
+
+    namespace detail {
+        /**
+         * @brief Bits sorted per pass; 256 buckets fit comfortably in L1.
+         */
+        inline constexpr unsigned radix_bits = 8;
+        inline constexpr std::size_t radix_buckets = std::size_t{1} << radix_bits;
+
+        /**
+         * @brief Ranges shorter than this are insertion sorted on the mapped key.
+         */
+        inline constexpr std::ptrdiff_t radix_sort_threshold = 64;
+
+        template<typename Key>
+        using RadixUnsigned = std::conditional_t<(sizeof(Key) <= 1), std::uint8_t,
+                              std::conditional_t<(sizeof(Key) <= 2), std::uint16_t,
+                              std::conditional_t<(sizeof(Key) <= 4), std::uint32_t, std::uint64_t>>>;
+
+        /**
+         * @brief Maps a key to an unsigned integer with the same ordering.
+         *
+         * Signed integers get their sign bit flipped. Floats with the sign bit set are
+         * inverted entirely, others get only the sign bit set, so that -0.0 sorts just
+         * before +0.0 and negative values sort in reverse magnitude order.
+         */
+        template<RadixKey Key>
+        constexpr RadixUnsigned<Key> radix_map(Key key) noexcept {
+            using Bits = RadixUnsigned<Key>;
+            constexpr Bits sign = Bits{1} << (sizeof(Key) * 8 - 1);
+            if constexpr (std::floating_point<Key>) {
+                const Bits bits = std::bit_cast<Bits>(key);
+                return (bits & sign) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign);
+            } else if constexpr (std::is_signed_v<Key>) {
+                return static_cast<Bits>(static_cast<Bits>(key) ^ sign);
+            } else {
+                return static_cast<Bits>(key);
+            }
+        }
+
+        template<typename Bits>
+        constexpr std::size_t radix_digit(Bits bits, unsigned pass) noexcept {
+            return static_cast<std::size_t>((bits >> (pass * radix_bits)) & (radix_buckets - 1));
+        }
+
+        /**
+         * @brief Stably scatters [src, src + size) into dst by one digit.
+         * @param offsets Digit histogram, turned into running output offsets in place
+         */
+        template<typename SrcIt, typename DstIt, typename MappedKey>
+        void radix_scatter(SrcIt src, DstIt dst, std::ptrdiff_t size, unsigned pass,
+                           std::array<std::size_t, radix_buckets>& offsets, MappedKey& mapped_key) {
+            std::size_t sum = 0;
+            for (auto& offset : offsets) {
+                const std::size_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+            for (std::ptrdiff_t i = 0; i < size; ++i) {
+                const std::size_t digit = radix_digit(mapped_key(src[i]), pass);
+                dst[static_cast<std::ptrdiff_t>(offsets[digit]++)] = std::move(src[i]);
+            }
+        }
+
+        /**
+         * @brief LSD radix sort shared by the radix_sort overloads; the buffer comes from alloc.
+         */
+        template<typename RandomIt, typename Projection, typename Allocator>
+        void radix_sort(RandomIt first, RandomIt last, Projection& proj, const Allocator& alloc) {
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            using Key = std::remove_cvref_t<std::invoke_result_t<Projection&, const ValueType&>>;
+            constexpr unsigned passes = sizeof(Key) * 8 / detail::radix_bits;
+
+            const auto size = std::distance(first, last);
+            if (size <= 1) return;
+
+            auto mapped_key = [&proj](const ValueType& value) {
+                return detail::radix_map(static_cast<Key>(std::invoke(proj, value)));
+            };
+
+            if (size < detail::radix_sort_threshold) {
+                for (auto it = std::next(first); it != last; ++it) {
+                    auto value = std::move(*it);
+                    const auto key = mapped_key(value);
+                    auto hole = it;
+                    while (hole != first && key < mapped_key(*std::prev(hole))) {
+                        *hole = std::move(*std::prev(hole));
+                        --hole;
+                    }
+                    *hole = std::move(value);
+                }
+                return;
+            }
+
+            std::array<std::array<std::size_t, detail::radix_buckets>, passes> counts{};
+            for (auto it = first; it != last; ++it) {
+                const auto key = mapped_key(*it);
+                for (unsigned pass = 0; pass < passes; ++pass) {
+                    ++counts[pass][detail::radix_digit(key, pass)];
+                }
+            }
+
+            // A digit shared by every key leaves the order unchanged; any element tells which one it is
+            std::array<bool, passes> skip{};
+            bool any_pass = false;
+            const auto first_key = mapped_key(*first);
+            for (unsigned pass = 0; pass < passes; ++pass) {
+                skip[pass] = counts[pass][detail::radix_digit(first_key, pass)] == static_cast<std::size_t>(size);
+                any_pass = any_pass || !skip[pass];
+            }
+            if (!any_pass) return;
+
+            // Moving the input into the buffer gives both sides n live elements to move-assign into
+            std::vector<ValueType, utils::RebindAlloc<Allocator, ValueType>> buffer(
+                std::make_move_iterator(first), std::make_move_iterator(last), alloc);
+            bool data_in_buffer = true;
+
+            for (unsigned pass = 0; pass < passes; ++pass) {
+                if (skip[pass]) continue;
+
+                if (data_in_buffer) {
+                    detail::radix_scatter(buffer.begin(), first, size, pass, counts[pass], mapped_key);
+                } else {
+                    detail::radix_scatter(first, buffer.begin(), size, pass, counts[pass], mapped_key);
+                }
+                data_in_buffer = !data_in_buffer;
+            }
+
+            if (data_in_buffer) {
+                std::move(buffer.begin(), buffer.end(), first);
+            }
+        }
+    }
+
+    /**
+     * @brief Sorts a range by an integral or floating-point key with an LSD radix sort.
+     *
+     * Keys are mapped to unsigned integers with the same ordering and sorted one byte
+     * at a time, least significant first, by stable counting passes that move the
+     * elements back and forth between the range and one auxiliary buffer. The
+     * histograms of all bytes are gathered in a single read of the input, and any
+     * byte that is the same for every key is skipped, so e.g. 64-bit timestamps that
+     * span a few days only need as many passes as their low bytes actually vary.
+     *
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Projection Callable returning the key of an element; the key type must
+     *   satisfy RadixKey
+     *
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param proj Key extractor (defaults to std::identity, sorting the values themselves)
+     *
+     * @par Complexity:
+     * - Time: O(w * n) where w is the number of key bytes that are not constant
+     * - Space: O(n) for the auxiliary buffer
+     *
+     * @par Algorithm Properties:
+     * - Stable: Yes (elements with equal keys maintain relative order)
+     * - Not comparison based: keys are ordered by value; for floats, -0.0 sorts before
+     *   +0.0 and NaNs sort after +infinity (or before -infinity if their sign bit is set)
+     * - The projection is called several times per element and should be cheap
+     *
+     * @par Example:
+     * ```cpp
+     * std::vector<Event> events = load_events();
+     * algorithms::sorting::radix_sort(events.begin(), events.end(),
+     *                                 [](const Event& e) { return e.timestamp; });
+     * ```
+     *
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Projection = std::identity>
+        requires RadixKey<std::remove_cvref_t<
+            std::invoke_result_t<Projection&, const typename std::iterator_traits<RandomIt>::value_type&>>>
+    void radix_sort(RandomIt first, RandomIt last, Projection proj = {}) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for radix sort.");
+        detail::radix_sort(first, last, proj, std::allocator<typename std::iterator_traits<RandomIt>::value_type>());
+    }
+
+    /**
+     * @brief Sorts a range by key with LSD radix sort, allocating its buffer with alloc.
+     *
+     * Same algorithm and result as the overload without an allocator; the auxiliary
+     * buffer of n elements comes from alloc.
+     *
+     * @tparam RandomIt Random access iterator type; value type must be move constructible
+     *   and move assignable
+     * @tparam Projection Callable returning the key of an element; the key type must
+     *   satisfy RadixKey
+     * @tparam Allocator Type satisfying utils::SimpleAllocator; rebound to the value type
+     *
+     * @param first Iterator to the beginning of the range to sort
+     * @param last Iterator to the end of the range to sort
+     * @param proj Key extractor
+     * @param alloc Allocator for the buffer
+     *
+     * @ingroup sorting
+     */
+    template<typename RandomIt, typename Projection, utils::SimpleAllocator Allocator>
+        requires RadixKey<std::remove_cvref_t<
+            std::invoke_result_t<Projection&, const typename std::iterator_traits<RandomIt>::value_type&>>>
+    void radix_sort(RandomIt first, RandomIt last, Projection proj, const Allocator& alloc) {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<RandomIt>::iterator_category>,
+                      "Iterator must be a random access iterator for radix sort.");
+        detail::radix_sort(first, last, proj, alloc);
+    }
+
+    /** @} */ // end of sorting group
+
+} // namespace sorting
+} // namespace algorithms
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @addtogroup utils
+     * @{
+     */
+
+    /**
+     * @brief A standard allocator, for any value type; algorithms rebind it to the element types they store.
+     *
+     * Allocator-aware overloads take such an allocator for their scratch buffers,
+     * e.g. `std::pmr::polymorphic_allocator<>(&arena)` to draw everything from a
+     * per-request std::pmr::monotonic_buffer_resource and release it in one shot.
+     */
+    template<typename A>
+    concept SimpleAllocator = std::copy_constructible<A> && requires(A& allocator, std::size_t n) {
+        typename A::value_type;
+        { *allocator.allocate(n) } -> std::same_as<typename A::value_type&>;
+        allocator.deallocate(allocator.allocate(n), n);
+    };
+
+    /**
+     * @brief The allocator A rebound to allocate T.
+     */
+    template<typename A, typename T>
+    using RebindAlloc = typename std::allocator_traits<A>::template rebind_alloc<T>;
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @addtogroup utils
+     * @{
+     */
+
+    /**
+     * @brief Operation counts gathered by CountingInstrumentation during one algorithm call.
+     */
+    struct InstrumentationCounters {
+        std::uint64_t comparisons = 0;     ///< Calls to the comparison function
+        std::uint64_t moves = 0;           ///< Elements moved into or out of scratch storage
+        std::uint64_t allocations = 0;     ///< Scratch buffers allocated or grown
+        std::uint64_t nodes_visited = 0;   ///< Nodes handed to the visit function
+        std::uint64_t edges_examined = 0;  ///< Neighbors read from get_neighbors
+        std::uint64_t frontier_peak = 0;   ///< Largest BFS level or DFS stack depth seen
+
+        friend bool operator==(const InstrumentationCounters&, const InstrumentationCounters&) = default;
+    };
+
+    /**
+     * @brief Hooks an algorithm calls on its hot path to report what it does.
+     *
+     * Instrumented overloads take the instrumentation by reference as their last
+     * argument and call `finish(name)` exactly once, just before they return normally.
+     * Each `count_*` hook may be called many times per element, so implementations
+     * should only add to counters there and leave anything expensive to finish().
+     */
+    template<typename I>
+    concept Instrumentation = requires(I& instrumentation, std::uint64_t count, std::string_view name) {
+        { I::enabled } -> std::convertible_to<bool>;
+        instrumentation.count_comparisons(count);
+        instrumentation.count_moves(count);
+        instrumentation.count_allocations(count);
+        instrumentation.count_nodes(count);
+        instrumentation.count_edges(count);
+        instrumentation.record_frontier(count);
+        instrumentation.finish(name);
+    };
+
+    /**
+     * @brief Instrumentation that records nothing.
+     *
+     * Every hook is an empty inline function, and algorithms skip any bookkeeping
+     * they would only do for instrumentation when `enabled` is false, so an overload
+     * called with NoInstrumentation compiles to the same code as the plain one.
+     */
+    struct NoInstrumentation {
+        static constexpr bool enabled = false;
+
+        constexpr void count_comparisons(std::uint64_t) const noexcept {}
+        constexpr void count_moves(std::uint64_t) const noexcept {}
+        constexpr void count_allocations(std::uint64_t) const noexcept {}
+        constexpr void count_nodes(std::uint64_t) const noexcept {}
+        constexpr void count_edges(std::uint64_t) const noexcept {}
+        constexpr void record_frontier(std::uint64_t) const noexcept {}
+        constexpr void finish(std::string_view) const noexcept {}
+    };
+
+    /**
+     * @brief Instrumentation that counts operations and reports them to a callback.
+     *
+     * The sink receives the algorithm name and the counters of the call when it
+     * finishes; the counters are then reset, so one object can be reused for many
+     * calls and each report covers exactly one. Not thread-safe: use one object per
+     * thread and aggregate in the sink.
+     *
+     * @par Example:
+     * ```cpp
+     * algorithms::utils::CountingInstrumentation metrics(
+     *     [&](std::string_view algorithm, const algorithms::utils::InstrumentationCounters& counters) {
+     *         registry.histogram(algorithm, "comparisons").record(counters.comparisons);
+     *     });
+     * algorithms::sorting::merge_sort(data.begin(), data.end(), std::less<>{}, metrics);
+     * ```
+     */
+    class CountingInstrumentation {
+    public:
+        using Sink = std::function<void(std::string_view, const InstrumentationCounters&)>;
+
+        static constexpr bool enabled = true;
+
+        CountingInstrumentation() = default;
+
+        explicit CountingInstrumentation(Sink sink) : sink_(std::move(sink)) {}
+
+        void count_comparisons(std::uint64_t count) noexcept { counters_.comparisons += count; }
+        void count_moves(std::uint64_t count) noexcept { counters_.moves += count; }
+        void count_allocations(std::uint64_t count) noexcept { counters_.allocations += count; }
+        void count_nodes(std::uint64_t count) noexcept { counters_.nodes_visited += count; }
+        void count_edges(std::uint64_t count) noexcept { counters_.edges_examined += count; }
+
+        void record_frontier(std::uint64_t size) noexcept {
+            counters_.frontier_peak = std::max(counters_.frontier_peak, size);
+        }
+
+        /**
+         * @brief Hands the counters to the sink, if any, then resets them.
+         */
+        void finish(std::string_view algorithm) {
+            if (sink_) sink_(algorithm, counters_);
+            counters_ = {};
+        }
+
+        /**
+         * @brief Returns the counts accumulated since the last finish().
+         */
+        const InstrumentationCounters& counters() const noexcept { return counters_; }
+
+    private:
+        Sink sink_;
+        InstrumentationCounters counters_;
+    };
+
+    /**
+     * @brief Wraps comp so that every call is counted; returns comp itself when instrumentation is disabled.
+     */
+    template<Instrumentation I, typename Compare>
+    constexpr auto counting_compare(Compare& comp, I& instrumentation) {
+        if constexpr (I::enabled) {
+            return [&comp, &instrumentation](const auto& a, const auto& b) -> bool {
+                instrumentation.count_comparisons(1);
+                return comp(a, b);
+            };
+        } else {
+            (void)instrumentation;
+            return std::ref(comp);
+        }
+    }
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ALGORITHMS_HAS_MMAP 1
+#endif
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @addtogroup utils
+     * @{
+     */
+
+    /**
+     * @brief Read-only view of a whole file's contents.
+     *
+     * On POSIX systems the file is mapped with `mmap(PROT_READ, MAP_SHARED)`: opening
+     * costs O(1), pages are read on first access, and every process mapping the same
+     * file shares one copy in the page cache. Elsewhere the file is read into a heap
+     * buffer, with the same interface.
+     *
+     * The contents must not be modified by other writers while mapped.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief Maps the file at path.
+         * @throws std::runtime_error If the file cannot be opened, inspected or mapped
+         */
+        explicit MappedFile(const std::filesystem::path& path) {
+#if defined(ALGORITHMS_HAS_MMAP)
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("cannot open file: " + path.string());
+            struct stat info {};
+            if (::fstat(fd, &info) != 0) {
+                ::close(fd);
+                throw std::runtime_error("cannot stat file: " + path.string());
+            }
+            size_ = static_cast<std::size_t>(info.st_size);
+            if (size_ > 0) {
+                void* address = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                if (address == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("cannot map file: " + path.string());
+                }
+                data_ = static_cast<const std::byte*>(address);
+            }
+            // The mapping stays valid after the descriptor is closed
+            ::close(fd);
+#else
+            std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.string().c_str(), "rb"), &std::fclose);
+            if (!file) throw std::runtime_error("cannot open file: " + path.string());
+            size_ = static_cast<std::size_t>(std::filesystem::file_size(path));
+            buffer_ = std::make_unique<std::byte[]>(size_);
+            if (std::fread(buffer_.get(), 1, size_, file.get()) != size_) {
+                throw std::runtime_error("error reading file: " + path.string());
+            }
+            data_ = buffer_.get();
+#endif
+        }
+
+        MappedFile(MappedFile&& other) noexcept { swap(other); }
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            MappedFile(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+#if defined(ALGORITHMS_HAS_MMAP)
+            if (data_ != nullptr) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+        }
+
+        /**
+         * @brief Returns the file contents; valid until the object is destroyed or moved from.
+         */
+        std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+
+        std::size_t size() const noexcept { return size_; }
+
+    private:
+        void swap(MappedFile& other) noexcept {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+#if !defined(ALGORITHMS_HAS_MMAP)
+            std::swap(buffer_, other.buffer_);
+#endif
+        }
+
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+#if !defined(ALGORITHMS_HAS_MMAP)
+        std::unique_ptr<std::byte[]> buffer_;
+#endif
+    };
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
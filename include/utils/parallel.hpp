@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @defgroup utils Utilities
+     * @brief Building blocks shared by the algorithm headers
+     * @ingroup algorithms
+     * @{
+     */
+
+    /**
+     * @brief Execution policy requesting that an algorithm run on several threads.
+     *
+     * Parallel overloads take this policy as their first argument, mirroring the
+     * standard execution-policy overloads, e.g.
+     * `bfs_iterative(utils::ParallelPolicy{8}, graph, start, visit)`.
+     *
+     * A thread count of 0 means "use std::thread::hardware_concurrency()".
+     */
+    struct ParallelPolicy {
+        std::size_t thread_count = 0;
+
+        /**
+         * @brief Returns the number of threads to use, always at least 1.
+         */
+        std::size_t resolved_thread_count() const noexcept {
+            if (thread_count != 0) return thread_count;
+            return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+    };
+
+    /**
+     * @brief Runs `body(thread_index)` on `thread_count` threads and waits for all of them.
+     *
+     * The calling thread runs index 0 itself, so a thread count of 1 spawns nothing.
+     * If any invocation throws, the first exception is rethrown after every thread
+     * has been joined.
+     *
+     * @param thread_count Number of invocations, each on its own thread.
+     * @param body Callable compatible with `void(std::size_t)`.
+     */
+    template<typename Body>
+    void run_parallel(std::size_t thread_count, Body&& body) {
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto guarded = [&](std::size_t index) {
+            try {
+                body(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(thread_count > 0 ? thread_count - 1 : 0);
+            for (std::size_t i = 1; i < thread_count; ++i) {
+                workers.emplace_back(guarded, i);
+            }
+            guarded(0);
+        }
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    /**
+     * @brief Splits `[0, count)` into chunks of `grain` indices handed out dynamically.
+     *
+     * Each thread repeatedly claims the next chunk from a shared atomic counter and
+     * calls `body(thread_index, chunk_begin, chunk_end)`, so uneven chunks balance
+     * themselves across threads.
+     *
+     * @param thread_count Number of threads to run.
+     * @param count Number of indices to process.
+     * @param grain Chunk size, at least 1.
+     * @param body Callable compatible with `void(std::size_t, std::size_t, std::size_t)`.
+     */
+    template<typename Body>
+    void parallel_for_chunks(std::size_t thread_count, std::size_t count, std::size_t grain, Body&& body) {
+        grain = std::max<std::size_t>(1, grain);
+        const std::size_t chunks = (count + grain - 1) / grain;
+        thread_count = std::max<std::size_t>(1, std::min(thread_count, chunks));
+
+        std::atomic<std::size_t> next_chunk{0};
+        run_parallel(thread_count, [&](std::size_t thread_index) {
+            for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                 chunk < chunks;
+                 chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+                const std::size_t begin = chunk * grain;
+                body(thread_index, begin, std::min(count, begin + grain));
+            }
+        });
+    }
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
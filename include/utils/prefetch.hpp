@@ -0,0 +1,51 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @addtogroup utils
+     * @{
+     */
+
+    /**
+     * @brief Hints the CPU to start loading the cache line holding address for reading.
+     *
+     * Compiles to a single prefetch instruction on GCC, Clang and MSVC (x86), and to
+     * nothing elsewhere or during constant evaluation. A prefetch never faults, but
+     * callers should still only pass addresses inside the object they are reading.
+     *
+     * @param address Any address; it is not dereferenced.
+     */
+    constexpr void prefetch(const void* address) noexcept {
+        if (std::is_constant_evaluated()) return;
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    /**
+     * @brief Prefetches the element it points to if Iterator is contiguous; no-op otherwise.
+     */
+    template<typename Iterator>
+    constexpr void prefetch_element(const Iterator& it) noexcept {
+        if constexpr (std::contiguous_iterator<Iterator>) {
+            prefetch(std::to_address(it));
+        }
+    }
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(ALGORITHMS_NO_SIMD)
+// Scalar code only, as on targets without a supported instruction set
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define ALGORITHMS_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALGORITHMS_SIMD_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ALGORITHMS_SIMD_NEON 1
+#endif
+
+#if defined(ALGORITHMS_SIMD_AVX2) || defined(ALGORITHMS_SIMD_SSE2) || defined(ALGORITHMS_SIMD_NEON)
+#define ALGORITHMS_SIMD 1
+#endif
+
+namespace algorithms {
+namespace utils {
+    /**
+     * @addtogroup utils
+     * @{
+     */
+
+    /**
+     * @brief Minimal equality-compare SIMD layer over the best instruction set enabled at compile time.
+     *
+     * Selects AVX2 when the translation unit is compiled with it (e.g. `-mavx2` or
+     * `-march=native`), SSE2 on any other x86-64 target, and NEON on AArch64. Only
+     * what lane-wise equality searches need is provided: unaligned loads, broadcast,
+     * per-type equality, OR, and a movemask-style bit mask. `simd::available` is false
+     * on other targets, or when `ALGORITHMS_NO_SIMD` is defined, and then nothing else
+     * in this namespace is declared: callers guard their vector code with
+     * `#if defined(ALGORITHMS_SIMD)`, since a discarded `if constexpr` branch still
+     * looks up qualified names.
+     */
+    namespace simd {
+#if defined(ALGORITHMS_SIMD)
+        inline constexpr bool available = true;
+#else
+        inline constexpr bool available = false;
+#endif
+
+        /**
+         * @brief Element types supported by equal(): non-bool integers, float and double.
+         */
+        template<typename T>
+        inline constexpr bool supported =
+            available && std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+            (std::is_integral_v<T> ? (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+                                   : (std::is_same_v<T, float> || std::is_same_v<T, double>));
+
+#if defined(ALGORITHMS_SIMD_AVX2)
+        using Register = __m256i;
+        inline constexpr std::size_t width = 32;
+        /// Bits set in mask() per matching byte
+        inline constexpr unsigned mask_bits_per_byte = 1;
+
+        inline Register load(const void* address) noexcept {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(address));
+        }
+
+        inline Register bitwise_or(Register a, Register b) noexcept { return _mm256_or_si256(a, b); }
+
+        inline std::uint64_t mask(Register r) noexcept {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(r));
+        }
+
+        template<typename T>
+        inline Register broadcast(T value) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return _mm256_castps_si256(_mm256_set1_ps(value));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return _mm256_castpd_si256(_mm256_set1_pd(value));
+            } else if constexpr (sizeof(T) == 1) {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm256_set1_epi16(static_cast<short>(value));
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm256_set1_epi32(static_cast<int>(value));
+            } else {
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+            }
+        }
+
+        template<typename T>
+        inline Register equal(Register a, Register b) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+            } else if constexpr (sizeof(T) == 1) {
+                return _mm256_cmpeq_epi8(a, b);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm256_cmpeq_epi16(a, b);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm256_cmpeq_epi32(a, b);
+            } else {
+                return _mm256_cmpeq_epi64(a, b);
+            }
+        }
+#elif defined(ALGORITHMS_SIMD_SSE2)
+        using Register = __m128i;
+        inline constexpr std::size_t width = 16;
+        /// Bits set in mask() per matching byte
+        inline constexpr unsigned mask_bits_per_byte = 1;
+
+        inline Register load(const void* address) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(address));
+        }
+
+        inline Register bitwise_or(Register a, Register b) noexcept { return _mm_or_si128(a, b); }
+
+        inline std::uint64_t mask(Register r) noexcept {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(r));
+        }
+
+        template<typename T>
+        inline Register broadcast(T value) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return _mm_castps_si128(_mm_set1_ps(value));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return _mm_castpd_si128(_mm_set1_pd(value));
+            } else if constexpr (sizeof(T) == 1) {
+                return _mm_set1_epi8(static_cast<char>(value));
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm_set1_epi16(static_cast<short>(value));
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm_set1_epi32(static_cast<int>(value));
+            } else {
+                return _mm_set1_epi64x(static_cast<long long>(value));
+            }
+        }
+
+        template<typename T>
+        inline Register equal(Register a, Register b) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+            } else if constexpr (sizeof(T) == 1) {
+                return _mm_cmpeq_epi8(a, b);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm_cmpeq_epi16(a, b);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm_cmpeq_epi32(a, b);
+            } else {
+                // SSE2 has no 64-bit compare: both 32-bit halves must match
+                const __m128i halves = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+#elif defined(ALGORITHMS_SIMD_NEON)
+        using Register = uint8x16_t;
+        inline constexpr std::size_t width = 16;
+        /// Bits set in mask() per matching byte
+        inline constexpr unsigned mask_bits_per_byte = 4;
+
+        inline Register load(const void* address) noexcept {
+            return vld1q_u8(static_cast<const std::uint8_t*>(address));
+        }
+
+        inline Register bitwise_or(Register a, Register b) noexcept { return vorrq_u8(a, b); }
+
+        // Narrowing shift packs each byte's compare result into a nibble of one 64-bit lane
+        inline std::uint64_t mask(Register r) noexcept {
+            return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(r), 4)), 0);
+        }
+
+        template<typename T>
+        inline Register broadcast(T value) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return vreinterpretq_u8_f32(vdupq_n_f32(value));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return vreinterpretq_u8_f64(vdupq_n_f64(value));
+            } else if constexpr (sizeof(T) == 1) {
+                return vdupq_n_u8(static_cast<std::uint8_t>(value));
+            } else if constexpr (sizeof(T) == 2) {
+                return vreinterpretq_u8_u16(vdupq_n_u16(static_cast<std::uint16_t>(value)));
+            } else if constexpr (sizeof(T) == 4) {
+                return vreinterpretq_u8_u32(vdupq_n_u32(static_cast<std::uint32_t>(value)));
+            } else {
+                return vreinterpretq_u8_u64(vdupq_n_u64(static_cast<std::uint64_t>(value)));
+            }
+        }
+
+        template<typename T>
+        inline Register equal(Register a, Register b) noexcept {
+            if constexpr (std::is_same_v<T, float>) {
+                return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+            } else if constexpr (std::is_same_v<T, double>) {
+                return vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(a), vreinterpretq_f64_u8(b)));
+            } else if constexpr (sizeof(T) == 1) {
+                return vceqq_u8(a, b);
+            } else if constexpr (sizeof(T) == 2) {
+                return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+            } else if constexpr (sizeof(T) == 4) {
+                return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+            } else {
+                return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b)));
+            }
+        }
+#endif
+
+#if defined(ALGORITHMS_SIMD)
+        /**
+         * @brief Index of the first lane of T set in a mask() result.
+         * @pre m != 0
+         */
+        template<typename T>
+        inline std::size_t first_lane(std::uint64_t m) noexcept {
+            return static_cast<std::size_t>(std::countr_zero(m)) / (sizeof(T) * mask_bits_per_byte);
+        }
+#endif
+    }
+
+    /** @} */ // end of utils group
+
+} // namespace utils
+} // namespace algorithms
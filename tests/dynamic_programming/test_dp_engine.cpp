@@ -0,0 +1,167 @@
+#include <iostream>
+
+#include "dynamic_programming/dp_engine.hpp"
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+std::size_t reference_edit_distance(const std::string& a, const std::string& b) {
+    std::vector<std::vector<std::size_t>> d(a.size() + 1, std::vector<std::size_t>(b.size() + 1));
+    for (std::size_t i = 0; i <= a.size(); ++i) {
+        for (std::size_t j = 0; j <= b.size(); ++j) {
+            if (i == 0 || j == 0) {
+                d[i][j] = i + j;
+            } else {
+                d[i][j] = std::min({d[i - 1][j] + 1, d[i][j - 1] + 1, d[i - 1][j - 1] + (a[i - 1] != b[j - 1])});
+            }
+        }
+    }
+    return d[a.size()][b.size()];
+}
+
+auto edit_distance_recurrence(const std::string& a, const std::string& b) {
+    return [&a, &b](std::size_t i, std::size_t j, const auto& d) -> std::size_t {
+        if (i == 0 || j == 0) return i + j;
+        return std::min({d(i - 1, j) + 1, d(i, j - 1) + 1, d(i - 1, j - 1) + (a[i - 1] != b[j - 1])});
+    };
+}
+
+std::string random_string(std::mt19937& rng, std::size_t size) {
+    std::string s(size, 'a');
+    for (auto& c : s) c = static_cast<char>('a' + rng() % 4);
+    return s;
+}
+
+void test_tabulate_edit_distance() {
+    std::mt19937 rng(3);
+    for (auto [n, m] : {std::pair<std::size_t, std::size_t>{0, 0}, {0, 5}, {7, 0}, {13, 29}, {200, 317}, {500, 64}}) {
+        const std::string a = random_string(rng, n);
+        const std::string b = random_string(rng, m);
+        [[maybe_unused]] const std::size_t expected = reference_edit_distance(a, b);
+
+        algorithms::dynamic_programming::FlatTable<std::size_t> flat(n + 1, m + 1);
+        algorithms::dynamic_programming::tabulate(flat, edit_distance_recurrence(a, b));
+        assert(flat(n, m) == expected);
+
+        algorithms::dynamic_programming::RollingTable<std::size_t> rolling(n + 1, m + 1, 2);
+        algorithms::dynamic_programming::tabulate(rolling, edit_distance_recurrence(a, b));
+        assert(rolling(n, m) == expected);
+
+        for (std::size_t threads : {2, 4}) {
+            algorithms::dynamic_programming::FlatTable<std::size_t> parallel(n + 1, m + 1);
+            algorithms::dynamic_programming::tabulate(algorithms::utils::ParallelPolicy{threads}, parallel,
+                                                      edit_distance_recurrence(a, b));
+            assert(parallel(n, m) == expected);
+        }
+    }
+
+    std::cout << "Tabulate edit distance test passed!" << std::endl;
+}
+
+void test_tabulate_knapsack() {
+    const std::vector<std::size_t> weight = {3, 4, 5, 9, 4, 1, 7};
+    const std::vector<int> value = {3, 4, 4, 10, 4, 1, 8};
+    const std::size_t capacity = 20;
+
+    // best(i, c): best value using the first i items within capacity c
+    auto knapsack = [&](std::size_t i, std::size_t c, const auto& best) {
+        if (i == 0) return 0;
+        int skip = best(i - 1, c);
+        if (weight[i - 1] > c) return skip;
+        return std::max(skip, best(i - 1, c - weight[i - 1]) + value[i - 1]);
+    };
+
+    int expected = 0;
+    for (unsigned subset = 0; subset < (1u << weight.size()); ++subset) {
+        std::size_t w = 0;
+        int v = 0;
+        for (std::size_t k = 0; k < weight.size(); ++k) {
+            if (subset & (1u << k)) {
+                w += weight[k];
+                v += value[k];
+            }
+        }
+        if (w <= capacity) expected = std::max(expected, v);
+    }
+
+    algorithms::dynamic_programming::RollingTable<int> rolling(weight.size() + 1, capacity + 1, 2);
+    algorithms::dynamic_programming::tabulate(rolling, knapsack);
+    assert(rolling(weight.size(), capacity) == expected);
+
+    algorithms::dynamic_programming::FlatTable<int> flat(weight.size() + 1, capacity + 1);
+    algorithms::dynamic_programming::tabulate(algorithms::utils::ParallelPolicy{3}, flat, knapsack);
+    assert(flat(weight.size(), capacity) == expected);
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::dynamic_programming::RollingTable<int> invalid(4, 4, 0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Tabulate knapsack test passed!" << std::endl;
+}
+
+void test_solve_memoized() {
+    std::size_t calls = 0;
+    [[maybe_unused]] auto fib = [&calls](std::uint64_t n, const auto& solve) -> std::uint64_t {
+        ++calls;
+        return n < 2 ? n : solve(n - 1) + solve(n - 2);
+    };
+    algorithms::dynamic_programming::HashCache<std::uint64_t, std::uint64_t> cache;
+    assert(algorithms::dynamic_programming::solve_memoized(90, fib, cache) == 2880067194370816120ull);
+    assert(calls == 91);
+    assert(cache.size() == 91);
+
+    // Cached states are reused across calls
+    assert(algorithms::dynamic_programming::solve_memoized(50, fib, cache) == 12586269025ull);
+    assert(calls == 91);
+
+    cache.clear();
+    assert(cache.size() == 0);
+
+    std::cout << "Solve memoized test passed!" << std::endl;
+}
+
+void test_solve_memoized_sharded() {
+    // Number of monotone lattice paths to (x, y), shared by threads solving different roots
+    auto paths = [](std::uint64_t key, const auto& solve) -> std::uint64_t {
+        const std::uint64_t x = key >> 32;
+        const std::uint64_t y = key & 0xffffffffu;
+        if (x == 0 || y == 0) return 1;
+        return solve(((x - 1) << 32) | y) + solve((x << 32) | (y - 1));
+    };
+
+    algorithms::dynamic_programming::ShardedHashCache<std::uint64_t, std::uint64_t> cache;
+    std::atomic<bool> ok{true};
+    algorithms::utils::run_parallel(4, [&](std::size_t thread) {
+        for (std::uint64_t n = 10 + thread; n <= 30; n += 4) {
+            // C(2n, n)
+            std::uint64_t expected = 1;
+            for (std::uint64_t k = 1; k <= n; ++k) expected = expected * (n + k) / k;
+            if (algorithms::dynamic_programming::solve_memoized((n << 32) | n, paths, cache) != expected) {
+                ok = false;
+            }
+        }
+    });
+    assert(ok);
+    assert(cache.size() == 31 * 31 - 1);
+
+    std::cout << "Solve memoized sharded test passed!" << std::endl;
+}
+
+int main() {
+    test_tabulate_edit_distance();
+    test_tabulate_knapsack();
+    test_solve_memoized();
+    test_solve_memoized_sharded();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -1,6 +1,9 @@
 #include <iostream>
 
 #include "dynamic_programming/fibonacci.hpp"
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
 #include <cassert>
 
 void test_fibonacci_int() {
@@ -87,10 +90,103 @@ void test_fibonacci_struct() {
     std::cout << "All Fibonacci struct tests passed!" << std::endl;
 }
 
+void test_fibonacci_doubling() {
+    for (int i = 0; i <= 93; ++i) {
+        assert(algorithms::dynamic_programming::fibonacci_doubling(static_cast<std::uint64_t>(i)) ==
+               algorithms::dynamic_programming::fibonacci<std::uint64_t>(i));
+    }
+    for (int i = 0; i <= 30; ++i) {
+        assert(algorithms::dynamic_programming::fibonacci_doubling<long long>(static_cast<std::uint64_t>(i), 2, 1) ==
+               algorithms::dynamic_programming::fibonacci<long long>(i, 2, 1));
+    }
+    assert(algorithms::dynamic_programming::fibonacci_doubling<double>(50) == 12586269025.0);
+
+    static_assert(algorithms::dynamic_programming::fibonacci_doubling(90) == 2880067194370816120ull);
+    static_assert(algorithms::dynamic_programming::fibonacci_doubling<int>(0, 7, 9) == 7);
+
+    std::cout << "All Fibonacci doubling tests passed!" << std::endl;
+}
+
+void test_fibonacci_mod() {
+    // Small moduli match the exact values reduced
+    for ([[maybe_unused]] std::uint64_t m : {1ull, 2ull, 10ull, 1000000007ull, 18446744073709551557ull}) {
+        for (int i = 0; i <= 93; ++i) {
+            [[maybe_unused]] const std::uint64_t exact = algorithms::dynamic_programming::fibonacci<std::uint64_t>(i);
+            assert(algorithms::dynamic_programming::fibonacci_mod(static_cast<std::uint64_t>(i), m) == exact % m);
+        }
+    }
+
+    // Pisano period of 10 is 60
+    assert(algorithms::dynamic_programming::fibonacci_mod(1000000000000000000ull, 10) ==
+           algorithms::dynamic_programming::fibonacci_mod(1000000000000000000ull % 60, 10));
+    static_assert(algorithms::dynamic_programming::fibonacci_mod(1000000000000000000ull, 1000000007) == 209783453);
+    static_assert(algorithms::dynamic_programming::fibonacci_mod(5, 1000, 2, 1) == 11);
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::dynamic_programming::fibonacci_mod(5, 0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "All Fibonacci mod tests passed!" << std::endl;
+}
+
+void test_fibonacci_table() {
+    static_assert(algorithms::dynamic_programming::fibonacci_table<std::uint64_t>.size() == 94);
+    static_assert(algorithms::dynamic_programming::fibonacci_table<std::int64_t>.size() == 93);
+    static_assert(algorithms::dynamic_programming::fibonacci_table<std::int32_t>.size() == 47);
+    static_assert(algorithms::dynamic_programming::fibonacci_table<std::uint8_t>.size() == 14);
+    static_assert(algorithms::dynamic_programming::fibonacci_table<std::uint64_t>[93] == 12200160415121876738ull);
+    static_assert(algorithms::dynamic_programming::fibonacci_lookup(10) == 55);
+
+    const auto& table = algorithms::dynamic_programming::fibonacci_table<int>;
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        assert(table[i] == algorithms::dynamic_programming::fibonacci<int>(static_cast<int>(i)));
+        assert(algorithms::dynamic_programming::fibonacci_lookup<int>(i) == table[i]);
+    }
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::dynamic_programming::fibonacci_lookup<std::int32_t>(47);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "All Fibonacci table tests passed!" << std::endl;
+}
+
+void test_fibonacci_fill() {
+    std::vector<std::uint64_t> values(94);
+    algorithms::dynamic_programming::fibonacci_fill(std::span<std::uint64_t>(values));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(values[i] == algorithms::dynamic_programming::fibonacci_table<std::uint64_t>[i]);
+    }
+
+    std::vector<double> seeded(20);
+    algorithms::dynamic_programming::fibonacci_fill(std::span<double>(seeded), 2.0, 1.0);
+    for (std::size_t i = 0; i < seeded.size(); ++i) {
+        assert(seeded[i] == algorithms::dynamic_programming::fibonacci<double>(static_cast<int>(i), 2.0, 1.0));
+    }
+
+    std::vector<int> one(1);
+    algorithms::dynamic_programming::fibonacci_fill(std::span<int>(one), 5, 8);
+    assert(one[0] == 5);
+    algorithms::dynamic_programming::fibonacci_fill(std::span<int>());
+
+    std::cout << "All Fibonacci fill tests passed!" << std::endl;
+}
+
 int main() {
     test_fibonacci_int();
     test_fibonacci_float();
     test_fibonacci_struct();
+    test_fibonacci_doubling();
+    test_fibonacci_mod();
+    test_fibonacci_table();
+    test_fibonacci_fill();
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include <iostream>
 
 #include "graph/breadth_first_search.hpp"
+#include <span>
 #include <vector>
 #include <algorithm>
+#include <string_view>
 #include <cassert>
 
 void test_breadth_first_search() {
@@ -53,8 +55,161 @@ void test_breadth_first_search() {
     std::cout << "BFS-complete test passed!" << std::endl;
 }
 
+void test_breadth_first_search_indexed() {
+    struct indexed_graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        indexed_graph(int n) : adj_list(n) {}
+        void add_edge(int u, int v) {
+            adj_list[u].push_back(v);
+        }
+        std::vector<int> get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            std::vector<int> nodes;
+            for (std::size_t i = 0; i < adj_list.size(); ++i) {
+                nodes.push_back(i);
+            }
+            return nodes;
+        }
+        std::size_t node_count() const {
+            return adj_list.size();
+        }
+    };
+    static_assert(algorithms::graph::IndexedGraph<indexed_graph>);
+
+    // Cycle back to the start and across the 64-bit word boundary of the bitset
+    indexed_graph g(70);
+    g.add_edge(0, 1);
+    g.add_edge(0, 65);
+    g.add_edge(1, 69);
+    g.add_edge(65, 0);
+    g.add_edge(69, 1);
+
+    std::vector<int> expected_order = {0, 1, 65, 69};
+    std::vector<int> bfs_order;
+    algorithms::graph::bfs_iterative(g, 0, [&bfs_order](int node) {
+        bfs_order.push_back(node);
+    });
+    assert(bfs_order == expected_order);
+    std::cout << "BFS-iterative indexed test passed!" << std::endl;
+    bfs_order.clear();
+
+    algorithms::graph::bfs_complete(g, [&bfs_order](int node) {
+        bfs_order.push_back(node);
+    });
+    assert(bfs_order.size() == 70);
+    assert(bfs_order[0] == 0 && bfs_order[1] == 1 && bfs_order[2] == 65 && bfs_order[3] == 69);
+    assert(bfs_order[4] == 2 && bfs_order.back() == 68);
+    std::cout << "BFS-complete indexed test passed!" << std::endl;
+}
+
+void test_breadth_first_search_by_level() {
+    struct graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        graph(int n) : adj_list(n) {}
+        void add_edge(int u, int v) {
+            adj_list[u].push_back(v);
+        }
+        std::vector<int> get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            std::vector<int> nodes;
+            for (std::size_t i = 0; i < adj_list.size(); ++i) {
+                nodes.push_back(i);
+            }
+            return nodes;
+        }
+    };
+    graph g(7);
+    g.add_edge(0, 1);
+    g.add_edge(0, 2);
+    g.add_edge(1, 3);
+    g.add_edge(2, 4);
+    g.add_edge(3, 5);
+    g.add_edge(5, 6);
+
+    std::vector<int> bfs_order;
+    std::vector<std::vector<int>> levels;
+    algorithms::graph::bfs_by_level(g, 0, [&bfs_order](int node) {
+        bfs_order.push_back(node);
+    }, [&levels](std::size_t depth, std::span<const int> frontier) {
+        if (depth > 2) return false;
+        levels.emplace_back(frontier.begin(), frontier.end());
+        return true;
+    });
+    std::vector<int> expected_order = {0, 1, 2, 3, 4};
+    std::vector<std::vector<int>> expected_levels = {{0}, {1, 2}, {3, 4}};
+    assert(bfs_order == expected_order);
+    assert(levels == expected_levels);
+    std::cout << "BFS-by-level depth limit test passed!" << std::endl;
+
+    // A wide star must not degrade to quadratic work
+    const int leaves = 200000;
+    graph star(leaves + 1);
+    for (int i = 1; i <= leaves; ++i) {
+        star.add_edge(0, i);
+    }
+    std::size_t visited_count = 0;
+    algorithms::graph::bfs_iterative(star, 0, [&visited_count](int) {
+        ++visited_count;
+    });
+    assert(visited_count == static_cast<std::size_t>(leaves) + 1);
+    std::cout << "BFS wide frontier test passed!" << std::endl;
+}
+
+void test_breadth_first_search_instrumented() {
+    struct graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        std::vector<int> get_neighbors(int u) const { return adj_list[u]; }
+        std::vector<int> get_all_nodes() const { return {0, 1, 2, 3, 4, 5}; }
+        std::size_t node_count() const { return adj_list.size(); }
+    };
+    // 0 -> 1, 2, 3; 1 -> 4; 2 -> 4; 3 -> 5; 4 -> 0
+    graph g{{{1, 2, 3}, {4}, {4}, {5}, {0}, {}}};
+
+    std::vector<std::string_view> reports;
+    algorithms::utils::InstrumentationCounters reported;
+    algorithms::utils::CountingInstrumentation metrics(
+        [&](std::string_view algorithm, const algorithms::utils::InstrumentationCounters& counters) {
+            reports.push_back(algorithm);
+            reported = counters;
+        });
+
+    std::vector<int> order;
+    algorithms::graph::bfs_iterative(g, 0, [&order](int node) { order.push_back(node); }, metrics);
+    assert((order == std::vector<int>{0, 1, 2, 3, 4, 5}));
+    assert(reports.size() == 1 && reports[0] == "bfs_iterative");
+    assert(reported.nodes_visited == 6);
+    assert(reported.edges_examined == 7);
+    assert(reported.frontier_peak == 3);
+    assert(reported.allocations > 0);
+    assert(reported.comparisons == 0 && reported.moves == 0);
+
+    // Stop still reports, with the work done so far
+    algorithms::graph::bfs_iterative(g, 0, [](int node) {
+        return node == 1 ? algorithms::graph::TraversalControl::Stop : algorithms::graph::TraversalControl::Continue;
+    }, metrics);
+    assert(reports.size() == 2);
+    assert(reported.nodes_visited == 2 && reported.edges_examined == 3);
+
+    order.clear();
+    algorithms::utils::NoInstrumentation none;
+    algorithms::graph::bfs_iterative(g, 0, [&order](int node) { order.push_back(node); }, none);
+    assert((order == std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    std::cout << "BFS instrumentation test passed!" << std::endl;
+}
+
 int main() {
     test_breadth_first_search();
+    test_breadth_first_search_indexed();
+    test_breadth_first_search_by_level();
+    test_breadth_first_search_instrumented();
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <iostream>
+
+#include "graph/connected_components.hpp"
+#include "graph/csr_graph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+// Reference labels by repeated relaxation to the smallest reachable id
+std::vector<std::size_t> reference_labels(std::size_t node_count,
+                                          const std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges) {
+    std::vector<std::size_t> root(node_count);
+    for (std::size_t i = 0; i < node_count; ++i) root[i] = i;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (const auto& [u, v] : edges) {
+            const std::size_t low = std::min(root[u], root[v]);
+            if (root[u] != low || root[v] != low) {
+                root[u] = root[v] = low;
+                changed = true;
+            }
+        }
+    }
+    std::vector<std::size_t> labels(node_count);
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < node_count; ++i) labels[i] = root[i] == i ? count++ : labels[root[i]];
+    return labels;
+}
+
+void test_connected_components_dense() {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{4, 1}, {2, 0}, {5, 5}, {1, 6}};
+    algorithms::graph::CsrGraph<> g(7, edges);
+
+    std::vector<std::size_t> labels(7);
+    [[maybe_unused]] const std::size_t count = algorithms::graph::connected_components(g, std::span<std::size_t>(labels));
+    assert(count == 4);
+    assert((labels == std::vector<std::size_t>{0, 1, 0, 2, 1, 3, 1}));
+
+    std::vector<std::size_t> small(3);
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::connected_components(g, std::span<std::size_t>(small));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    algorithms::graph::CsrGraph<> empty;
+    assert(algorithms::graph::connected_components(empty, std::span<std::size_t>()) == 0);
+
+    std::cout << "Connected components dense test passed!" << std::endl;
+}
+
+void test_connected_components_parallel() {
+    std::mt19937 rng(17);
+    for (std::size_t node_count : {1, 50, 20000}) {
+        for (std::size_t edge_factor : {0, 1, 3}) {
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+            for (std::size_t i = 0; i < node_count * edge_factor / 2; ++i) {
+                edges.emplace_back(static_cast<std::uint32_t>(rng() % node_count),
+                                   static_cast<std::uint32_t>(rng() % node_count));
+            }
+            const auto expected = reference_labels(node_count, edges);
+            algorithms::graph::CsrGraph<> g(node_count, edges);
+
+            for (std::size_t threads : {1, 2, 8}) {
+                const algorithms::utils::ParallelPolicy policy{threads};
+                std::vector<std::size_t> from_graph(node_count);
+                algorithms::graph::connected_components(policy, g, std::span<std::size_t>(from_graph));
+                assert(from_graph == expected);
+
+                std::vector<std::size_t> from_edges(node_count);
+                algorithms::graph::connected_components(policy, node_count, edges, std::span<std::size_t>(from_edges));
+                assert(from_edges == expected);
+            }
+        }
+    }
+
+    std::vector<std::pair<int, int>> bad = {{0, 1}, {1, 3}};
+    std::vector<std::size_t> labels(3);
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::connected_components(algorithms::utils::ParallelPolicy{2}, 3, bad,
+                                                std::span<std::size_t>(labels));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Connected components parallel test passed!" << std::endl;
+}
+
+void test_connected_components_hashed() {
+    struct graph {
+        using NodeType = std::string;
+        std::unordered_map<std::string, std::vector<std::string>> adj_list;
+        std::vector<std::string> get_neighbors(const std::string& u) const { return adj_list.at(u); }
+        std::vector<std::string> get_all_nodes() const { return {"a", "b", "c", "d", "e"}; }
+    };
+    graph g{{{"a", {"c"}}, {"b", {}}, {"c", {}}, {"d", {"b"}}, {"e", {}}}};
+
+    std::unordered_map<std::string, std::size_t> labels;
+    [[maybe_unused]] const std::size_t count = algorithms::graph::connected_components(g, labels);
+    assert(count == 3);
+    assert(labels.size() == 5);
+    assert(labels["a"] == 0 && labels["c"] == 0);
+    assert(labels["b"] == 1 && labels["d"] == 1);
+    assert(labels["e"] == 2);
+
+    std::cout << "Connected components hashed test passed!" << std::endl;
+}
+
+void test_disjoint_sets() {
+    algorithms::graph::DisjointSets sets(6);
+    assert(sets.unite(5, 3));
+    assert(sets.unite(3, 4));
+    assert(!sets.unite(4, 5));
+    assert(sets.find(5) == 3 && sets.find(4) == 3);
+    assert(sets.find(0) == 0);
+
+    // Concurrent unions of one long chain end up in a single set rooted at 0
+    const std::size_t size = 100000;
+    algorithms::graph::DisjointSets chain(size);
+    algorithms::utils::parallel_for_chunks(4, size - 1, 97, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) chain.unite(size - 1 - i, size - 2 - i);
+    });
+    for (std::size_t i = 0; i < size; i += 999) assert(chain.find(i) == 0);
+
+    std::cout << "Disjoint sets test passed!" << std::endl;
+}
+
+int main() {
+    test_connected_components_dense();
+    test_connected_components_parallel();
+    test_connected_components_hashed();
+    test_disjoint_sets();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
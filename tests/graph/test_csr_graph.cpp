@@ -0,0 +1,123 @@
+#include <iostream>
+
+#include "graph/csr_graph.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/depth_first_search.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+void test_csr_graph_construction() {
+    using Graph = algorithms::graph::CsrGraph<>;
+    static_assert(algorithms::graph::IndexedGraph<Graph>);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {
+        {1, 3}, {0, 1}, {1, 4}, {0, 2}, {4, 0}
+    };
+    Graph g(5, edges);
+    assert(g.node_count() == 5);
+    assert(g.edge_count() == 5);
+
+    // Neighbors keep the relative order of the edge list
+    auto n0 = g.get_neighbors(0);
+    assert(n0.size() == 2 && n0[0] == 1 && n0[1] == 2);
+    auto n1 = g.get_neighbors(1);
+    assert(n1.size() == 2 && n1[0] == 3 && n1[1] == 4);
+    assert(g.get_neighbors(2).empty());
+    assert(g.degree(4) == 1);
+
+    // Spans point into the graph's storage, no copy is made
+    assert(g.get_neighbors(1).data() == g.targets().data() + g.offsets()[1]);
+
+    std::vector<std::uint32_t> nodes;
+    for (auto node : g.get_all_nodes()) {
+        nodes.push_back(node);
+    }
+    assert((nodes == std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+
+    Graph empty;
+    assert(empty.node_count() == 0 && empty.edge_count() == 0);
+
+    std::cout << "CSR graph construction tests passed." << std::endl;
+}
+
+void test_csr_graph_invalid_input() {
+    std::vector<std::pair<int, int>> bad_edges = {{0, 1}, {1, 5}};
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::CsrGraph<int> g(3, bad_edges);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try {
+        algorithms::graph::CsrGraph<int> g(std::vector<std::size_t>{0, 2, 1}, std::vector<int>{0});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 300 nodes cannot be numbered with std::uint8_t
+    thrown = false;
+    try {
+        algorithms::graph::CsrGraph<std::uint8_t> g(300, std::vector<std::pair<int, int>>{{0, 299}});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try {
+        algorithms::graph::CsrGraph<std::uint8_t> g(std::vector<std::size_t>(301, 0), std::vector<std::uint8_t>{});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    algorithms::graph::CsrGraph<std::uint8_t> largest(255, std::vector<std::pair<int, int>>{{0, 254}});
+    assert(largest.get_neighbors(0)[0] == 254);
+    assert(std::ranges::distance(largest.get_all_nodes()) == 255);
+
+    algorithms::graph::CsrGraph<int> adopted(std::vector<std::size_t>{0, 1, 1}, std::vector<int>{1});
+    assert(adopted.node_count() == 2);
+    assert(adopted.get_neighbors(0)[0] == 1);
+
+    std::cout << "CSR graph invalid input tests passed." << std::endl;
+}
+
+void test_csr_graph_traversals() {
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {3, 0}};
+    algorithms::graph::CsrGraph<int> g(6, edges);
+
+    std::vector<int> bfs_order;
+    algorithms::graph::bfs_iterative(g, 0, [&bfs_order](int node) {
+        bfs_order.push_back(node);
+    });
+    assert((bfs_order == std::vector<int>{0, 1, 2, 3, 4}));
+
+    std::vector<int> dfs_order;
+    algorithms::graph::dfs_iterative(g, 0, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert((dfs_order == std::vector<int>{0, 1, 3, 4, 2}));
+
+    std::vector<int> complete_order;
+    algorithms::graph::dfs_complete(g, [&complete_order](int node) {
+        complete_order.push_back(node);
+    });
+    assert((complete_order == std::vector<int>{0, 1, 3, 4, 2, 5}));
+
+    std::cout << "CSR graph traversal tests passed." << std::endl;
+}
+
+int main() {
+    test_csr_graph_construction();
+    test_csr_graph_invalid_input();
+    test_csr_graph_traversals();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include <iostream>
+
+#include "graph/delta_stepping.hpp"
+#include "graph/csr_graph.hpp"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <cassert>
+
+void test_delta_stepping_matches_dijkstra() {
+    std::mt19937 rng(9);
+    for (std::size_t node_count : {1, 3, 100, 5000}) {
+        std::vector<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t>> edges;
+        for (std::size_t i = 0; i < node_count * 5; ++i) {
+            edges.emplace_back(static_cast<std::uint32_t>(rng() % node_count),
+                               static_cast<std::uint32_t>(rng() % node_count),
+                               static_cast<std::uint32_t>(rng() % 1000));
+        }
+        algorithms::graph::WeightedCsrGraph<std::uint32_t, std::uint32_t> g(node_count, edges);
+        const auto expected = algorithms::graph::dijkstra(g, 0).distance;
+
+        for (std::size_t threads : {1, 2, 4}) {
+            for (std::uint32_t delta : {1u, 50u, 400u, 5000u}) {
+                const auto distance = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{threads}, g, 0, delta);
+                assert(distance == expected);
+            }
+        }
+    }
+
+    std::cout << "Delta-stepping matches Dijkstra tests passed." << std::endl;
+}
+
+void test_delta_stepping_floating() {
+    // A grid with random real weights and an unreachable node
+    const std::size_t side = 60;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> weight(0.0, 3.0);
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, double>> edges;
+    for (std::size_t r = 0; r < side; ++r) {
+        for (std::size_t c = 0; c < side; ++c) {
+            const auto node = static_cast<std::uint32_t>(r * side + c);
+            if (c + 1 < side) {
+                edges.emplace_back(node, node + 1, weight(rng));
+                edges.emplace_back(node + 1, node, weight(rng));
+            }
+            if (r + 1 < side) {
+                edges.emplace_back(node, static_cast<std::uint32_t>(node + side), weight(rng));
+                edges.emplace_back(static_cast<std::uint32_t>(node + side), node, weight(rng));
+            }
+        }
+    }
+    algorithms::graph::WeightedCsrGraph<std::uint32_t, double> g(side * side + 1, edges);
+    const auto expected = algorithms::graph::dijkstra(g, 0).distance;
+
+    const auto distance = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{4}, g, 0, 1.5);
+    assert(distance == expected);
+    assert(distance[side * side] == std::numeric_limits<double>::infinity());
+
+    std::cout << "Delta-stepping floating point tests passed." << std::endl;
+}
+
+void test_delta_stepping_tiny_delta() {
+    // A delta far below the heaviest edge would need billions of buckets; it is raised instead
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, std::uint64_t>> edges = {
+        {0, 1, 1}, {1, 2, 4'000'000'000'000}, {0, 2, 5'000'000'000'000}, {2, 3, 7}};
+    algorithms::graph::WeightedCsrGraph<std::uint32_t, std::uint64_t> g(4, edges);
+    const auto distance = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{2}, g, 0, std::uint64_t{1});
+    assert(distance == algorithms::graph::dijkstra(g, 0).distance);
+    assert(distance[3] == 4'000'000'000'008);
+
+    std::vector<std::tuple<int, int, double>> real_edges = {{0, 1, 1e-9}, {1, 2, 1e300}, {0, 2, 2e300}};
+    algorithms::graph::WeightedCsrGraph<int, double> real(3, real_edges);
+    const auto real_distance = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{2}, real, 0, 1e-300);
+    assert(real_distance == algorithms::graph::dijkstra(real, 0).distance);
+
+    // Paths longer than the largest weight value are reported unreached, as with dijkstra
+    const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+    algorithms::graph::WeightedCsrGraph<int, std::int64_t> heavy(
+        3, std::vector<std::tuple<int, int, std::int64_t>>{{0, 1, max - 5}, {1, 2, 10}});
+    const auto saturated = algorithms::graph::delta_stepping(algorithms::utils::ParallelPolicy{2}, heavy, 0, max / 4);
+    assert(saturated == algorithms::graph::dijkstra(heavy, 0).distance);
+    assert(saturated[1] == max - 5 && saturated[2] == max);
+
+    std::cout << "Delta-stepping tiny delta tests passed." << std::endl;
+}
+
+void test_delta_stepping_errors() {
+    algorithms::graph::WeightedCsrGraph<int, int> g(2, std::vector<std::tuple<int, int, int>>{{0, 1, 4}});
+    const algorithms::utils::ParallelPolicy policy{2};
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::delta_stepping(policy, g, 0, 0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try {
+        algorithms::graph::delta_stepping(policy, g, 2, 1);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    algorithms::graph::WeightedCsrGraph<int, int> negative(2, std::vector<std::tuple<int, int, int>>{{0, 1, -3}});
+    thrown = false;
+    try {
+        algorithms::graph::delta_stepping(policy, negative, 0, 1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    for (double weight : {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()}) {
+        algorithms::graph::WeightedCsrGraph<int, double> non_finite(2, std::vector<std::tuple<int, int, double>>{{0, 1, weight}});
+        thrown = false;
+        try {
+            algorithms::graph::delta_stepping(policy, non_finite, 0, 1.0);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "Delta-stepping error tests passed." << std::endl;
+}
+
+int main() {
+    test_delta_stepping_matches_dijkstra();
+    test_delta_stepping_floating();
+    test_delta_stepping_tiny_delta();
+    test_delta_stepping_errors();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -1,8 +1,10 @@
 #include <iostream>
 
 #include "graph/depth_first_search.hpp"
+#include <list>
 #include <vector>
 #include <algorithm>
+#include <string_view>
 #include <cassert>
 
 void test_depth_first_search() {
@@ -78,8 +80,220 @@ void test_depth_first_search() {
 
 }
 
+void test_depth_first_search_indexed() {
+    struct indexed_graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        indexed_graph(int n) : adj_list(n) {}
+        void add_edge(int u, int v) {
+            adj_list[u].push_back(v);
+        }
+        std::vector<int> get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            std::vector<int> nodes;
+            for (std::size_t i = 0; i < adj_list.size(); ++i) {
+                nodes.push_back(i);
+            }
+            return nodes;
+        }
+        std::size_t node_count() const {
+            return adj_list.size();
+        }
+    };
+    static_assert(algorithms::graph::IndexedGraph<indexed_graph>);
+
+    indexed_graph g(70);
+    g.add_edge(0, 65);
+    g.add_edge(0, 1);
+    g.add_edge(65, 69);
+    g.add_edge(69, 0);
+    g.add_edge(1, 69);
+
+    std::vector<int> expected_order = {0, 65, 69, 1};
+    std::vector<int> dfs_order;
+    algorithms::graph::dfs_recursive(g, 0, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert(dfs_order == expected_order);
+    std::cout << "DFS-recursive indexed test passed!" << std::endl;
+    dfs_order.clear();
+
+    algorithms::graph::dfs_iterative(g, 0, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert(dfs_order == expected_order);
+    std::cout << "DFS-iterative indexed test passed!" << std::endl;
+    dfs_order.clear();
+
+    algorithms::graph::dfs_complete(g, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert(dfs_order.size() == 70);
+    assert(dfs_order[0] == 0 && dfs_order[1] == 65 && dfs_order[2] == 69 && dfs_order[3] == 1);
+    assert(dfs_order[4] == 2 && dfs_order.back() == 68);
+    std::cout << "DFS-complete indexed test passed!" << std::endl;
+}
+
+void test_depth_first_search_pre_post_order() {
+    struct graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        graph(int n) : adj_list(n) {}
+        void add_edge(int u, int v) {
+            adj_list[u].push_back(v);
+        }
+        std::vector<int> get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            std::vector<int> nodes;
+            for (std::size_t i = 0; i < adj_list.size(); ++i) {
+                nodes.push_back(i);
+            }
+            return nodes;
+        }
+    };
+    graph g(5);
+    g.add_edge(0, 1);
+    g.add_edge(0, 2);
+    g.add_edge(1, 3);
+    g.add_edge(1, 4);
+    g.add_edge(4, 0);
+
+    std::vector<int> pre_order;
+    std::vector<int> post_order;
+    algorithms::graph::dfs_pre_post_order(g, 0, [&pre_order](int node) {
+        pre_order.push_back(node);
+    }, [&post_order](int node) {
+        post_order.push_back(node);
+    });
+    std::vector<int> expected_pre = {0, 1, 3, 4, 2};
+    std::vector<int> expected_post = {3, 4, 1, 2, 0};
+    assert(pre_order == expected_pre);
+    assert(post_order == expected_post);
+    std::cout << "DFS pre/post order test passed!" << std::endl;
+}
+
+void test_depth_first_search_neighbor_ranges() {
+    // Neighbors returned by const reference (borrowed) and as a non-random-access list
+    struct reference_graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        const std::vector<int>& get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            return {0, 1, 2, 3};
+        }
+    };
+    struct list_graph {
+        using NodeType = int;
+        std::vector<std::list<int>> adj_list;
+        std::list<int> get_neighbors(int u) const {
+            return adj_list[u];
+        }
+        std::vector<int> get_all_nodes() const {
+            return {0, 1, 2, 3};
+        }
+    };
+    reference_graph rg{{{1, 2}, {3}, {}, {0}}};
+    list_graph lg{{{1, 2}, {3}, {}, {0}}};
+
+    std::vector<int> expected_order = {0, 1, 3, 2};
+    std::vector<int> dfs_order;
+    algorithms::graph::dfs_iterative(rg, 0, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert(dfs_order == expected_order);
+    dfs_order.clear();
+
+    algorithms::graph::dfs_recursive(lg, 0, [&dfs_order](int node) {
+        dfs_order.push_back(node);
+    });
+    assert(dfs_order == expected_order);
+    std::cout << "DFS neighbor range kinds test passed!" << std::endl;
+}
+
+void test_depth_first_search_deep_chain() {
+    struct chain_graph {
+        using NodeType = int;
+        int length;
+        std::vector<int> get_neighbors(int u) const {
+            if (u + 1 < length) return {u + 1};
+            return {};
+        }
+        std::vector<int> get_all_nodes() const {
+            std::vector<int> nodes;
+            for (int i = 0; i < length; ++i) {
+                nodes.push_back(i);
+            }
+            return nodes;
+        }
+    };
+    // Deep enough to overflow the call stack with a recursive implementation
+    chain_graph g{500000};
+
+    int expected = 0;
+    bool in_order = true;
+    algorithms::graph::dfs_recursive(g, 0, [&](int node) {
+        in_order = in_order && node == expected++;
+    });
+    assert(in_order && expected == g.length);
+
+    expected = 0;
+    algorithms::graph::dfs_complete(g, [&](int node) {
+        in_order = in_order && node == expected++;
+    });
+    assert(in_order && expected == g.length);
+    std::cout << "DFS deep chain test passed!" << std::endl;
+}
+
+void test_depth_first_search_instrumented() {
+    struct graph {
+        using NodeType = int;
+        std::vector<std::vector<int>> adj_list;
+        std::vector<int> get_neighbors(int u) const { return adj_list[u]; }
+        std::vector<int> get_all_nodes() const { return {0, 1, 2, 3, 4, 5}; }
+        std::size_t node_count() const { return adj_list.size(); }
+    };
+    // 0 -> 1, 2, 3; 1 -> 4; 2 -> 4; 3 -> 5; 4 -> 0
+    graph g{{{1, 2, 3}, {4}, {4}, {5}, {0}, {}}};
+
+    std::vector<std::string_view> reports;
+    algorithms::utils::InstrumentationCounters reported;
+    algorithms::utils::CountingInstrumentation metrics(
+        [&](std::string_view algorithm, const algorithms::utils::InstrumentationCounters& counters) {
+            reports.push_back(algorithm);
+            reported = counters;
+        });
+
+    std::vector<int> order;
+    algorithms::graph::dfs_iterative(g, 0, [&order](int node) { order.push_back(node); }, metrics);
+    assert((order == std::vector<int>{0, 1, 4, 2, 3, 5}));
+    assert(reports.size() == 1 && reports[0] == "dfs_iterative");
+    assert(reported.nodes_visited == 6);
+    assert(reported.edges_examined == 7);
+    // Deepest stack: 0, 1, 4
+    assert(reported.frontier_peak == 3);
+    assert(reported.allocations > 0);
+
+    order.clear();
+    algorithms::utils::NoInstrumentation none;
+    algorithms::graph::dfs_iterative(g, 0, [&order](int node) { order.push_back(node); }, none);
+    assert((order == std::vector<int>{0, 1, 4, 2, 3, 5}));
+
+    std::cout << "DFS instrumentation test passed!" << std::endl;
+}
+
 int main() {
     test_depth_first_search();
+    test_depth_first_search_indexed();
+    test_depth_first_search_pre_post_order();
+    test_depth_first_search_neighbor_ranges();
+    test_depth_first_search_deep_chain();
+    test_depth_first_search_instrumented();
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <iostream>
+
+#include "graph/dijkstra.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/breadth_first_search.hpp"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+using Edge = std::tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+
+std::vector<std::uint64_t> bellman_ford(std::size_t node_count, const std::vector<Edge>& edges, std::uint32_t source) {
+    const std::uint64_t infinity = std::numeric_limits<std::uint64_t>::max();
+    std::vector<std::uint64_t> distance(node_count, infinity);
+    distance[source] = 0;
+    for (std::size_t round = 0; round < node_count; ++round) {
+        for (const auto& [u, v, w] : edges) {
+            if (distance[u] != infinity && distance[u] + w < distance[v]) distance[v] = distance[u] + w;
+        }
+    }
+    return distance;
+}
+
+std::vector<Edge> random_edges(std::mt19937& rng, std::size_t node_count, std::size_t edge_count, std::uint64_t max_weight) {
+    std::vector<Edge> edges;
+    for (std::size_t i = 0; i < edge_count; ++i) {
+        edges.emplace_back(static_cast<std::uint32_t>(rng() % node_count), static_cast<std::uint32_t>(rng() % node_count),
+                           rng() % (max_weight + 1));
+    }
+    return edges;
+}
+
+void test_weighted_csr_graph() {
+    using Graph = algorithms::graph::WeightedCsrGraph<std::uint32_t, int>;
+    static_assert(algorithms::graph::IndexedGraph<Graph>);
+    static_assert(algorithms::graph::WeightedGraph<Graph>);
+    static_assert(!algorithms::graph::WeightedGraph<algorithms::graph::CsrGraph<>>);
+
+    std::vector<std::tuple<int, int, int>> edges = {{1, 2, 7}, {0, 1, 3}, {0, 2, 9}};
+    Graph g(3, edges);
+    assert(g.node_count() == 3 && g.edge_count() == 3);
+
+    std::vector<std::pair<std::uint32_t, int>> out;
+    for (auto [node, weight] : g.get_weighted_neighbors(0)) out.emplace_back(node, weight);
+    assert((out == std::vector<std::pair<std::uint32_t, int>>{{1, 3}, {2, 9}}));
+    assert(g.get_neighbors(1).size() == 1 && g.edge_weights(1)[0] == 7);
+
+    // Unweighted traversals still work
+    std::vector<std::uint32_t> order;
+    algorithms::graph::bfs_iterative(g, 0, [&](std::uint32_t node) { order.push_back(node); });
+    assert((order == std::vector<std::uint32_t>{0, 1, 2}));
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        Graph bad(2, std::vector<std::tuple<int, int, int>>{{0, 2, 1}});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try {
+        algorithms::graph::WeightedCsrGraph<std::uint8_t, int> narrow(300, std::vector<std::tuple<int, int, int>>{{0, 299, 1}});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Weighted CSR graph tests passed." << std::endl;
+}
+
+void test_dijkstra_random() {
+    std::mt19937 rng(5);
+    for (std::size_t node_count : {1, 2, 10, 200}) {
+        for (std::uint64_t max_weight : {0, 1, 100}) {
+            const auto edges = random_edges(rng, node_count, node_count * 4, max_weight);
+            algorithms::graph::WeightedCsrGraph<std::uint32_t, std::uint64_t> g(node_count, edges);
+            const auto expected = bellman_ford(node_count, edges, 0);
+
+            const auto paths = algorithms::graph::dijkstra(g, 0);
+            assert(paths.distance == expected);
+
+            // Every reported path exists and has the reported length
+            for (std::uint32_t v = 0; v < node_count; ++v) {
+                const auto path = paths.path_to(v);
+                if (!paths.reached(v)) {
+                    assert(path.empty());
+                    continue;
+                }
+                assert(path.front() == 0 && path.back() == v);
+                std::uint64_t length = 0;
+                for (std::size_t k = 0; k + 1 < path.size(); ++k) {
+                    std::uint64_t best = std::numeric_limits<std::uint64_t>::max();
+                    for (auto [next, weight] : g.get_weighted_neighbors(path[k])) {
+                        if (next == path[k + 1]) best = std::min(best, weight);
+                    }
+                    length += best;
+                }
+                assert(length == paths.distance[v]);
+            }
+        }
+    }
+
+    std::cout << "Dijkstra random graph tests passed." << std::endl;
+}
+
+void test_dijkstra_target_and_errors() {
+    // 0 -> 1 -> 2 -> 3 is cheaper than 0 -> 3
+    std::vector<std::tuple<int, int, double>> edges = {{0, 3, 10.0}, {0, 1, 1.0}, {1, 2, 1.5}, {2, 3, 2.0}, {3, 4, 1.0}};
+    algorithms::graph::WeightedCsrGraph<int, double> g(6, edges);
+
+    const auto paths = algorithms::graph::dijkstra(g, 0, 3);
+    assert(paths.distance[3] == 4.5);
+    assert((paths.path_to(3) == std::vector<int>{0, 1, 2, 3}));
+    assert(!paths.reached(5));
+    assert(paths.distance[5] == std::numeric_limits<double>::infinity());
+
+    const auto all = algorithms::graph::dijkstra(g, 0);
+    assert(all.distance[4] == 5.5);
+    assert((all.path_to(0) == std::vector<int>{0}));
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::dijkstra(g, 6);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    algorithms::graph::WeightedCsrGraph<int, int> negative(2, std::vector<std::tuple<int, int, int>>{{0, 1, -1}});
+    thrown = false;
+    try {
+        algorithms::graph::dijkstra(negative, 0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // 0 -> 1 -> 2 would be longer than the largest int: 2 stays unreached, 3 is found through 0 -> 3
+    const int max = std::numeric_limits<int>::max();
+    algorithms::graph::WeightedCsrGraph<int, int> heavy(
+        4, std::vector<std::tuple<int, int, int>>{{0, 1, max - 5}, {1, 2, 10}, {0, 3, 7}, {1, 3, 1}});
+    const auto saturated = algorithms::graph::dijkstra(heavy, 0);
+    assert(saturated.distance[1] == max - 5);
+    assert(!saturated.reached(2));
+    assert(saturated.distance[3] == 7);
+
+    std::cout << "Dijkstra target and error tests passed." << std::endl;
+}
+
+void test_dijkstra_custom_graph() {
+    struct AdjacencyList {
+        using NodeType = int;
+        using WeightType = int;
+        std::vector<std::vector<std::pair<int, int>>> edges;
+
+        std::vector<int> get_neighbors(int node) const {
+            std::vector<int> result;
+            for (const auto& [v, w] : edges[node]) result.push_back(v);
+            return result;
+        }
+        const std::vector<std::pair<int, int>>& get_weighted_neighbors(int node) const { return edges[node]; }
+        std::vector<int> get_all_nodes() const { return {0, 1, 2}; }
+        std::size_t node_count() const { return 3; }
+    };
+    static_assert(algorithms::graph::WeightedGraph<AdjacencyList>);
+
+    AdjacencyList g{{{{1, 5}, {2, 1}}, {}, {{1, 2}}}};
+    const auto paths = algorithms::graph::dijkstra(g, 0);
+    assert(paths.distance[1] == 3 && paths.parent[1] == 2);
+
+    std::cout << "Dijkstra custom graph tests passed." << std::endl;
+}
+
+int main() {
+    test_weighted_csr_graph();
+    test_dijkstra_random();
+    test_dijkstra_target_and_errors();
+    test_dijkstra_custom_graph();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include <iostream>
+
+#include "graph/mapped_csr_graph.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+namespace {
+    std::filesystem::path temp_file(const std::string& name) {
+        return std::filesystem::temp_directory_path() / ("algorithms_test_" + name + ".csr");
+    }
+
+    // Node i links to i + 1, i + 7 and i / 2 (when in range), so deltas are both positive and negative
+    algorithms::graph::CsrGraph<> make_graph(std::uint32_t n) {
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+        for (std::uint32_t i = 0; i < n; ++i) {
+            if (i + 1 < n) edges.emplace_back(i, i + 1);
+            if (i + 7 < n) edges.emplace_back(i, i + 7);
+            if (i > 0) edges.emplace_back(i, i / 2);
+        }
+        return algorithms::graph::CsrGraph<>(n, edges);
+    }
+
+    std::vector<std::uint32_t> bfs_order(const auto& graph) {
+        std::vector<std::uint32_t> order;
+        algorithms::graph::bfs_iterative(graph, std::uint32_t{0}, [&](std::uint32_t node) { order.push_back(node); });
+        return order;
+    }
+
+    void patch_u64(const std::filesystem::path& path, std::uint64_t position, std::uint64_t value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(position));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template<typename Func>
+    bool throws_runtime_error(Func&& func) {
+        try {
+            func();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+void test_mapped_csr_concepts() {
+    static_assert(algorithms::graph::IndexedGraph<algorithms::graph::MappedCsrGraph<>>);
+    static_assert(algorithms::graph::ReversibleViewGraph<algorithms::graph::MappedCsrGraph<>>);
+    static_assert(algorithms::graph::IndexedGraph<algorithms::graph::MappedCompressedCsrGraph<>>);
+    static_assert(algorithms::graph::ViewGraph<algorithms::graph::MappedCompressedCsrGraph<>>);
+    static_assert(std::ranges::forward_range<algorithms::graph::VarintNeighborView<std::uint32_t>>);
+
+    std::cout << "Mapped CSR concept tests passed." << std::endl;
+}
+
+void test_mapped_csr_round_trip() {
+    const auto graph = make_graph(1000);
+    const auto path = temp_file("plain");
+    algorithms::graph::write_csr_file(path, graph);
+
+    {
+        algorithms::graph::MappedCsrGraph<> mapped(path);
+        mapped.validate();
+        assert(mapped.node_count() == graph.node_count());
+        assert(mapped.edge_count() == graph.edge_count());
+        for (std::uint32_t u = 0; u < 1000; ++u) {
+            assert(mapped.degree(u) == graph.degree(u));
+            assert(std::ranges::equal(mapped.get_neighbors(u), graph.get_neighbors(u)));
+        }
+        assert(bfs_order(mapped) == bfs_order(graph));
+    }
+    std::filesystem::remove(path);
+
+    std::cout << "Mapped CSR round trip tests passed." << std::endl;
+}
+
+void test_mapped_compressed_csr_round_trip() {
+    const auto graph = make_graph(1000);
+    const auto plain_path = temp_file("plain_size");
+    const auto path = temp_file("compressed");
+    algorithms::graph::write_csr_file(plain_path, graph);
+    algorithms::graph::write_csr_file(path, graph, {.compress = true});
+    assert(std::filesystem::file_size(path) < std::filesystem::file_size(plain_path));
+
+    {
+        algorithms::graph::MappedCompressedCsrGraph<> mapped(path);
+        assert(mapped.node_count() == graph.node_count());
+        assert(mapped.edge_count() == graph.edge_count());
+        for (std::uint32_t u = 0; u < 1000; ++u) {
+            assert(mapped.degree(u) == graph.degree(u));
+            assert(std::ranges::equal(mapped.get_neighbors(u), graph.get_neighbors(u)));
+        }
+        assert(bfs_order(mapped) == bfs_order(graph));
+
+        // Each format only opens with its own graph type
+        assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> wrong(path); }));
+        assert(throws_runtime_error([&] { algorithms::graph::MappedCompressedCsrGraph<> wrong(plain_path); }));
+    }
+    std::filesystem::remove(plain_path);
+    std::filesystem::remove(path);
+
+    std::cout << "Mapped compressed CSR round trip tests passed." << std::endl;
+}
+
+void test_mapped_csr_empty_graph() {
+    const auto path = temp_file("empty");
+    algorithms::graph::write_csr_file(path, algorithms::graph::CsrGraph<>());
+    {
+        algorithms::graph::MappedCsrGraph<> mapped(path);
+        assert(mapped.node_count() == 0 && mapped.edge_count() == 0);
+        assert(mapped.get_all_nodes().empty());
+    }
+    std::filesystem::remove(path);
+
+    std::cout << "Mapped CSR empty graph tests passed." << std::endl;
+}
+
+void test_mapped_csr_errors() {
+    const auto path = temp_file("errors");
+
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> missing(temp_file("missing")); }));
+
+    // Written with 32-bit ids, opened with 64-bit ids
+    algorithms::graph::write_csr_file(path, make_graph(10));
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<std::uint64_t> wrong(path); }));
+
+    // Truncated targets section
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> truncated(path); }));
+
+    // Bad magic
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        const std::string junk(128, 'x');
+        out.write(junk.data(), static_cast<std::streamsize>(junk.size()));
+    }
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> junk(path); }));
+
+    // Smaller than a header
+    std::filesystem::resize_file(path, 16);
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> tiny(path); }));
+
+    // A target outside the graph is only caught by validate()
+    struct {
+        using NodeType = std::uint32_t;
+        std::vector<std::uint32_t> get_neighbors(std::uint32_t node) const {
+            return node == 0 ? std::vector<std::uint32_t>{5} : std::vector<std::uint32_t>{};
+        }
+        std::vector<std::uint32_t> get_all_nodes() const { return {0, 1}; }
+        std::size_t node_count() const { return 2; }
+    } bad;
+    algorithms::graph::write_csr_file(path, bad);
+    {
+        algorithms::graph::MappedCsrGraph<> mapped(path);
+        assert(throws_runtime_error([&] { mapped.validate(); }));
+    }
+
+    // An edge count whose targets size wraps to 0, with offsets that agree with it
+    algorithms::graph::write_csr_file(path, algorithms::graph::CsrGraph<>(1, std::vector<std::pair<std::uint32_t, std::uint32_t>>{}));
+    const std::uint64_t huge = std::uint64_t{1} << 62;
+    algorithms::graph::CsrFileHeader header{};
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    }
+    patch_u64(path, offsetof(algorithms::graph::CsrFileHeader, edge_count), huge);
+    patch_u64(path, header.offsets_position + sizeof(std::uint64_t), huge);
+    assert(throws_runtime_error([&] { algorithms::graph::MappedCsrGraph<> wrapped(path); }));
+    std::filesystem::remove(path);
+
+    std::cout << "Mapped CSR error tests passed." << std::endl;
+}
+
+int main() {
+    test_mapped_csr_concepts();
+    test_mapped_csr_round_trip();
+    test_mapped_compressed_csr_round_trip();
+    test_mapped_csr_empty_graph();
+    test_mapped_csr_errors();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
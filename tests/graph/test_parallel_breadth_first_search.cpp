@@ -0,0 +1,109 @@
+#include <iostream>
+
+#include "graph/parallel_breadth_first_search.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+using Graph = algorithms::graph::CsrGraph<std::uint32_t>;
+using Edges = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+// Depth of every node reachable from start according to the serial BFS, -1 if unreachable
+std::vector<int> serial_depths(const Graph& g, std::uint32_t start) {
+    std::vector<int> depth(g.node_count(), -1);
+    algorithms::graph::bfs_by_level(g, start, [](std::uint32_t) {},
+        [&depth](std::size_t level, std::span<const std::uint32_t> frontier) {
+            for (auto node : frontier) depth[node] = static_cast<int>(level);
+            return true;
+        });
+    return depth;
+}
+
+// Checks that order visits exactly the reachable nodes, once each, level by level
+void check_bfs_order(const std::vector<std::uint32_t>& order, const std::vector<int>& depth) {
+    std::vector<int> seen(depth.size(), 0);
+    [[maybe_unused]] int last_depth = 0;
+    std::size_t reachable = 0;
+    for (auto d : depth) reachable += d >= 0;
+    assert(order.size() == reachable);
+    for (auto node : order) {
+        assert(depth[node] >= 0);
+        assert(++seen[node] == 1);
+        assert(depth[node] >= last_depth);
+        last_depth = depth[node];
+    }
+}
+
+Edges random_edges(std::uint32_t nodes, std::size_t count, bool symmetric, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<std::uint32_t> pick(0, nodes - 1);
+    Edges edges;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto u = pick(rng);
+        auto v = pick(rng);
+        edges.emplace_back(u, v);
+        if (symmetric) edges.emplace_back(v, u);
+    }
+    return edges;
+}
+
+void test_parallel_bfs_top_down() {
+    Graph g(5000, random_edges(5000, 6000, false, 1));
+    auto depth = serial_depths(g, 0);
+
+    for (std::size_t threads : {1, 2, 4}) {
+        std::vector<std::uint32_t> order;
+        algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{threads}, g, 0u,
+            [&order](std::uint32_t node) { order.push_back(node); });
+        check_bfs_order(order, depth);
+    }
+
+    std::cout << "Parallel top-down BFS tests passed." << std::endl;
+}
+
+void test_parallel_bfs_direction_optimizing() {
+    // Dense, low-diameter symmetric graph: the middle levels switch to bottom-up
+    Graph social(4000, random_edges(4000, 40000, true, 2));
+    auto depth = serial_depths(social, 7);
+
+    for (std::size_t threads : {1, 3, 4}) {
+        std::vector<std::uint32_t> order;
+        algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{threads}, social, social, 7u,
+            [&order](std::uint32_t node) { order.push_back(node); });
+        check_bfs_order(order, depth);
+    }
+
+    // Directed graph with an explicit transpose
+    Edges edges = random_edges(3000, 30000, false, 3);
+    Edges reversed;
+    for (auto [u, v] : edges) reversed.emplace_back(v, u);
+    Graph directed(3000, edges);
+    Graph transpose(3000, reversed);
+    auto directed_depth = serial_depths(directed, 0);
+
+    std::vector<std::uint32_t> order;
+    algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{4}, directed, transpose, 0u,
+        [&order](std::uint32_t node) { order.push_back(node); });
+    check_bfs_order(order, directed_depth);
+
+    // Single node with no edges
+    Graph lonely(1, Edges{});
+    order.clear();
+    algorithms::graph::bfs_iterative(algorithms::utils::ParallelPolicy{2}, lonely, lonely, 0u,
+        [&order](std::uint32_t node) { order.push_back(node); });
+    assert(order.size() == 1 && order[0] == 0);
+
+    std::cout << "Parallel direction-optimizing BFS tests passed." << std::endl;
+}
+
+int main() {
+    test_parallel_bfs_top_down();
+    test_parallel_bfs_direction_optimizing();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <iostream>
+
+#include "graph/reversed_neighbors.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/depth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+// Single-pass, move-only view in the style of a generator: its iterator points into the view
+class SuccessorGenerator : public std::ranges::view_base {
+public:
+    SuccessorGenerator(int node, int count, int modulus) : next_(node + 1), left_(count), modulus_(modulus) {}
+    SuccessorGenerator(SuccessorGenerator&&) = default;
+    SuccessorGenerator& operator=(SuccessorGenerator&&) = default;
+
+    class iterator {
+    public:
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(SuccessorGenerator* parent) : parent_(parent) {}
+        int operator*() const { return parent_->next_ % parent_->modulus_; }
+        iterator& operator++() {
+            ++parent_->next_;
+            --parent_->left_;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return parent_->left_ == 0; }
+
+    private:
+        SuccessorGenerator* parent_ = nullptr;
+    };
+
+    iterator begin() { return iterator(this); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    int next_;
+    int left_;
+    int modulus_;
+};
+
+// Single-pass view whose iterator returns a reference to the view's current value,
+// like std::ranges::istream_view: the reference is overwritten by the next increment
+class CachedSuccessorGenerator : public std::ranges::view_base {
+public:
+    CachedSuccessorGenerator(int node, int count, int modulus)
+        : current_((node + 1) % modulus), left_(count), modulus_(modulus) {}
+    CachedSuccessorGenerator(CachedSuccessorGenerator&&) = default;
+    CachedSuccessorGenerator& operator=(CachedSuccessorGenerator&&) = default;
+
+    class iterator {
+    public:
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(CachedSuccessorGenerator* parent) : parent_(parent) {}
+        const int& operator*() const { return parent_->current_; }
+        iterator& operator++() {
+            parent_->current_ = (parent_->current_ + 1) % parent_->modulus_;
+            --parent_->left_;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return parent_->left_ == 0; }
+
+    private:
+        CachedSuccessorGenerator* parent_ = nullptr;
+    };
+
+    iterator begin() { return iterator(this); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    int current_;
+    int left_;
+    int modulus_;
+};
+
+struct Edge {
+    std::uint32_t target;
+    float weight;
+};
+
+// Neighbors exposed as a transform view over a block of edge records
+struct EdgeBlockGraph {
+    using NodeType = std::uint32_t;
+    std::vector<std::vector<Edge>> blocks;
+
+    auto get_neighbors(std::uint32_t node) const {
+        return std::span<const Edge>(blocks[node]) | std::views::transform(&Edge::target);
+    }
+    std::ranges::iota_view<std::uint32_t, std::uint32_t> get_all_nodes() const {
+        return std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(blocks.size()));
+    }
+    std::size_t node_count() const { return blocks.size(); }
+};
+
+struct GeneratorGraph {
+    using NodeType = int;
+    int size;
+    SuccessorGenerator get_neighbors(int node) const { return SuccessorGenerator(node, 2, size); }
+    std::vector<int> get_all_nodes() const {
+        std::vector<int> nodes;
+        for (int i = 0; i < size; ++i) nodes.push_back(i);
+        return nodes;
+    }
+};
+
+// The cycle 0 -> 1 -> ... -> size - 1 -> 0
+struct CachedGeneratorGraph {
+    using NodeType = int;
+    int size;
+    CachedSuccessorGenerator get_neighbors(int node) const { return CachedSuccessorGenerator(node, 1, size); }
+    std::vector<int> get_all_nodes() const {
+        std::vector<int> nodes;
+        for (int i = 0; i < size; ++i) nodes.push_back(i);
+        return nodes;
+    }
+};
+
+struct VectorGraph {
+    using NodeType = int;
+    std::vector<std::vector<int>> adj_list;
+    std::vector<int> get_neighbors(int node) const { return adj_list[node]; }
+    std::vector<int> get_all_nodes() const { return {0, 1, 2, 3, 4}; }
+};
+
+void test_view_graph_concepts() {
+    static_assert(algorithms::graph::ReversibleViewGraph<algorithms::graph::CsrGraph<>>);
+    static_assert(algorithms::graph::ReversibleViewGraph<EdgeBlockGraph>);
+    static_assert(algorithms::graph::ViewGraph<GeneratorGraph>);
+    static_assert(!algorithms::graph::ReversibleViewGraph<GeneratorGraph>);
+    static_assert(algorithms::graph::Graph<VectorGraph> && !algorithms::graph::ViewGraph<VectorGraph>);
+
+    using Reversed = algorithms::graph::ReversedNeighbors<algorithms::graph::CsrGraph<>>;
+    static_assert(algorithms::graph::IndexedGraph<Reversed>);
+    static_assert(algorithms::graph::ReversibleViewGraph<Reversed>);
+    static_assert(algorithms::graph::IndexedGraph<algorithms::graph::ReversedNeighbors<EdgeBlockGraph>>);
+
+    std::cout << "View graph concept tests passed." << std::endl;
+}
+
+void test_transform_view_traversal() {
+    EdgeBlockGraph g{{{{1, 0.5f}, {2, 1.0f}}, {{3, 2.0f}}, {{3, 1.0f}}, {}}};
+
+    std::vector<std::uint32_t> order;
+    algorithms::graph::dfs_iterative(g, 0, [&](std::uint32_t node) { order.push_back(node); });
+    assert((order == std::vector<std::uint32_t>{0, 1, 3, 2}));
+
+    order.clear();
+    algorithms::graph::bfs_iterative(g, 0, [&](std::uint32_t node) { order.push_back(node); });
+    assert((order == std::vector<std::uint32_t>{0, 1, 2, 3}));
+
+    std::cout << "Transform view traversal tests passed." << std::endl;
+}
+
+void test_generator_traversal() {
+    // Node i has neighbors (i + 1) % n and (i + 2) % n; deep enough for the frame stack to reallocate
+    const int n = 2000;
+    GeneratorGraph generated{n};
+    std::vector<std::vector<int>> adj_list(n);
+    for (int i = 0; i < n; ++i) adj_list[i] = {(i + 1) % n, (i + 2) % n};
+    struct {
+        using NodeType = int;
+        const std::vector<std::vector<int>>* adj;
+        const std::vector<int>& get_neighbors(int node) const { return (*adj)[node]; }
+        std::vector<int> get_all_nodes() const { return {}; }
+    } reference{&adj_list};
+
+    std::vector<int> expected;
+    std::vector<int> actual;
+    algorithms::graph::dfs_pre_post_order(reference, 0, [](int) {}, [&](int node) { expected.push_back(node); });
+    algorithms::graph::dfs_pre_post_order(generated, 0, [](int) {}, [&](int node) { actual.push_back(node); });
+    assert(actual == expected && actual.size() == static_cast<std::size_t>(n));
+
+    expected.clear();
+    actual.clear();
+    algorithms::graph::bfs_iterative(reference, 0, [&](int node) { expected.push_back(node); });
+    algorithms::graph::bfs_iterative(generated, 0, [&](int node) { actual.push_back(node); });
+    assert(actual == expected);
+
+    std::cout << "Generator traversal tests passed." << std::endl;
+}
+
+void test_reference_generator_traversal() {
+    CachedGeneratorGraph g{5};
+    static_assert(std::is_same_v<std::ranges::range_reference_t<CachedSuccessorGenerator>, const int&>);
+
+    std::vector<int> order;
+    algorithms::graph::dfs_iterative(g, 0, [&](int node) { order.push_back(node); });
+    assert((order == std::vector<int>{0, 1, 2, 3, 4}));
+
+    order.clear();
+    algorithms::graph::bfs_iterative(g, 0, [&](int node) { order.push_back(node); });
+    assert((order == std::vector<int>{0, 1, 2, 3, 4}));
+
+    std::cout << "Reference generator traversal tests passed." << std::endl;
+}
+
+void test_reversed_neighbors() {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{0, 1}, {0, 2}, {1, 3}, {2, 4}};
+    algorithms::graph::CsrGraph<> g(5, edges);
+    algorithms::graph::ReversedNeighbors reversed(g);
+    assert(&reversed.base() == &g && reversed.node_count() == 5);
+
+    std::vector<std::uint32_t> neighbors;
+    for (auto node : reversed.get_neighbors(0)) neighbors.push_back(node);
+    assert((neighbors == std::vector<std::uint32_t>{2, 1}));
+
+    // Same order as a stack DFS that pushes all neighbors of the popped node
+    std::vector<std::uint32_t> order;
+    algorithms::graph::dfs_iterative(reversed, 0, [&](std::uint32_t node) { order.push_back(node); });
+    assert((order == std::vector<std::uint32_t>{0, 2, 4, 1, 3}));
+
+    EdgeBlockGraph blocks{{{{1, 0.0f}, {2, 0.0f}, {3, 0.0f}}, {}, {}, {}}};
+    order.clear();
+    algorithms::graph::bfs_iterative(algorithms::graph::ReversedNeighbors(blocks), 0,
+                                     [&](std::uint32_t node) { order.push_back(node); });
+    assert((order == std::vector<std::uint32_t>{0, 3, 2, 1}));
+
+    std::cout << "Reversed neighbors tests passed." << std::endl;
+}
+
+int main() {
+    test_view_graph_concepts();
+    test_transform_view_traversal();
+    test_generator_traversal();
+    test_reference_generator_traversal();
+    test_reversed_neighbors();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+
+#include "graph/topological_sort.hpp"
+#include "graph/csr_graph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+void test_topological_sort_dense() {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{3, 1}, {0, 1}, {1, 2}, {0, 3}, {4, 2}};
+    algorithms::graph::CsrGraph<> g(5, edges);
+
+    std::vector<std::uint32_t> order(5);
+    algorithms::graph::topological_sort(g, std::span<std::uint32_t>(order));
+    assert((order == std::vector<std::uint32_t>{0, 4, 3, 1, 2}));
+
+    // Random DAGs: edges always go from a lower to a higher rank
+    std::mt19937 rng(23);
+    for (std::size_t node_count : {1, 10, 3000}) {
+        std::vector<std::uint32_t> rank(node_count);
+        for (std::size_t i = 0; i < node_count; ++i) rank[i] = static_cast<std::uint32_t>(i);
+        std::shuffle(rank.begin(), rank.end(), rng);
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> dag;
+        for (std::size_t i = 0; i < node_count * 3; ++i) {
+            const auto a = static_cast<std::uint32_t>(rng() % node_count);
+            const auto b = static_cast<std::uint32_t>(rng() % node_count);
+            if (a == b) continue;
+            dag.emplace_back(rank[a] < rank[b] ? a : b, rank[a] < rank[b] ? b : a);
+        }
+        algorithms::graph::CsrGraph<> graph(node_count, dag);
+        std::vector<std::uint32_t> sorted(node_count);
+        algorithms::graph::topological_sort(graph, std::span<std::uint32_t>(sorted));
+
+        std::vector<std::size_t> position(node_count, node_count);
+        for (std::size_t i = 0; i < node_count; ++i) position[sorted[i]] = i;
+        for (std::size_t i = 0; i < node_count; ++i) assert(position[i] < node_count);
+        for ([[maybe_unused]] const auto& [u, v] : dag) assert(position[u] < position[v]);
+    }
+
+    std::cout << "Topological sort dense test passed!" << std::endl;
+}
+
+void test_topological_sort_errors() {
+    std::vector<std::pair<int, int>> cycle = {{0, 1}, {1, 2}, {2, 1}};
+    algorithms::graph::CsrGraph<int> g(4, cycle);
+    std::vector<int> order(4);
+
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::topological_sort(g, std::span<int>(order));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    algorithms::graph::CsrGraph<int> dag(3, std::vector<std::pair<int, int>>{{0, 1}});
+    std::vector<int> small(2);
+    thrown = false;
+    try {
+        algorithms::graph::topological_sort(dag, std::span<int>(small));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Topological sort errors test passed!" << std::endl;
+}
+
+void test_topological_sort_hashed() {
+    struct graph {
+        using NodeType = std::string;
+        std::unordered_map<std::string, std::vector<std::string>> adj_list;
+        std::vector<std::string> get_neighbors(const std::string& u) const { return adj_list.at(u); }
+        std::vector<std::string> get_all_nodes() const { return {"link", "compile", "fetch", "test"}; }
+    };
+    graph g{{{"fetch", {"compile"}}, {"compile", {"link", "test"}}, {"link", {"test"}}, {"test", {}}}};
+
+    const auto order = algorithms::graph::topological_sort(g);
+    assert((order == std::vector<std::string>{"fetch", "compile", "link", "test"}));
+
+    g.adj_list["test"] = {"fetch"};
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::graph::topological_sort(g);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Topological sort hashed test passed!" << std::endl;
+}
+
+int main() {
+    test_topological_sort_dense();
+    test_topological_sort_errors();
+    test_topological_sort_hashed();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
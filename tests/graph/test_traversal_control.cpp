@@ -0,0 +1,127 @@
+#include <iostream>
+
+#include "graph/traversal_control.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/depth_first_search.hpp"
+#include "graph/parallel_breadth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include <utility>
+#include <vector>
+#include <cassert>
+
+using algorithms::graph::TraversalControl;
+using Graph = algorithms::graph::CsrGraph<int>;
+
+// Tree: 0 -> {1, 2}, 1 -> {3, 4}, 2 -> {5}
+Graph make_tree() {
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {2, 5}};
+    return Graph(6, edges);
+}
+
+void test_invoke_visit() {
+    auto void_visit = [](int) {};
+    auto control_visit = [](int node) { return node == 0 ? TraversalControl::Stop : TraversalControl::Continue; };
+    static_assert(!algorithms::graph::detail::returns_traversal_control<decltype(void_visit), int>);
+    static_assert(algorithms::graph::detail::returns_traversal_control<decltype(control_visit), int>);
+    assert(algorithms::graph::detail::invoke_visit(void_visit, 0) == TraversalControl::Continue);
+    assert(algorithms::graph::detail::invoke_visit(control_visit, 0) == TraversalControl::Stop);
+
+    std::cout << "invoke_visit tests passed." << std::endl;
+}
+
+void test_bfs_control() {
+    Graph g = make_tree();
+
+    std::vector<int> order;
+    algorithms::graph::bfs_iterative(g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 2 ? TraversalControl::Stop : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 2}));
+    order.clear();
+
+    algorithms::graph::bfs_iterative(g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 1 ? TraversalControl::SkipChildren : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 2, 5}));
+    order.clear();
+
+    // Stop also ends the outer loop over components
+    algorithms::graph::bfs_complete(g, [&order](int node) {
+        order.push_back(node);
+        return node == 3 ? TraversalControl::Stop : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 2, 3}));
+
+    std::cout << "BFS traversal control tests passed." << std::endl;
+}
+
+void test_dfs_control() {
+    Graph g = make_tree();
+
+    std::vector<int> order;
+    algorithms::graph::dfs_iterative(g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 4 ? TraversalControl::Stop : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 3, 4}));
+    order.clear();
+
+    algorithms::graph::dfs_recursive(g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 1 ? TraversalControl::SkipChildren : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 2, 5}));
+    order.clear();
+
+    std::vector<int> post_order;
+    algorithms::graph::dfs_pre_post_order(g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 1 ? TraversalControl::SkipChildren : TraversalControl::Continue;
+    }, [&post_order](int node) {
+        post_order.push_back(node);
+    });
+    assert((order == std::vector<int>{0, 1, 2, 5}));
+    assert((post_order == std::vector<int>{1, 5, 2, 0}));
+    order.clear();
+
+    algorithms::graph::dfs_complete(g, [&order](int node) {
+        order.push_back(node);
+        return node == 3 ? TraversalControl::Stop : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0, 1, 3}));
+
+    std::cout << "DFS traversal control tests passed." << std::endl;
+}
+
+void test_parallel_bfs_control() {
+    Graph g = make_tree();
+    algorithms::utils::ParallelPolicy policy{2};
+
+    std::vector<int> order;
+    algorithms::graph::bfs_iterative(policy, g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 1 ? TraversalControl::SkipChildren : TraversalControl::Continue;
+    });
+    assert(order.size() == 4);
+    assert(order[0] == 0 && order.back() == 5);
+    order.clear();
+
+    algorithms::graph::bfs_iterative(policy, g, g, 0, [&order](int node) {
+        order.push_back(node);
+        return node == 0 ? TraversalControl::Stop : TraversalControl::Continue;
+    });
+    assert((order == std::vector<int>{0}));
+
+    std::cout << "Parallel BFS traversal control tests passed." << std::endl;
+}
+
+int main() {
+    test_invoke_visit();
+    test_bfs_control();
+    test_dfs_control();
+    test_parallel_bfs_control();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+
+#include "graph/traversal_workspace.hpp"
+#include "graph/breadth_first_search.hpp"
+#include "graph/depth_first_search.hpp"
+#include "graph/csr_graph.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+using Graph = algorithms::graph::CsrGraph<int>;
+
+void test_epoch_visited_set() {
+    algorithms::graph::EpochVisitedSet<int> visited;
+    visited.reset(4);
+    assert(visited.insert(3));
+    assert(!visited.insert(3));
+    assert(visited.contains(3));
+
+    visited.reset(8);
+    assert(!visited.contains(3));
+    assert(visited.insert(3));
+    assert(visited.insert(7));
+    assert(visited.contains(7));
+
+    std::cout << "Epoch visited set tests passed." << std::endl;
+}
+
+void test_workspace_reuse() {
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {3, 0}, {5, 4}};
+    Graph g(6, edges);
+    algorithms::graph::TraversalWorkspace<Graph> workspace;
+    static_assert(std::is_same_v<decltype(workspace)::VisitedSet, algorithms::graph::EpochVisitedSet<int>>);
+
+    for (int round = 0; round < 3; ++round) {
+        std::vector<int> bfs_order;
+        algorithms::graph::bfs_iterative(g, 0, [&bfs_order](int node) {
+            bfs_order.push_back(node);
+        }, workspace);
+        assert((bfs_order == std::vector<int>{0, 1, 2, 3, 4}));
+
+        std::vector<int> dfs_order;
+        algorithms::graph::dfs_iterative(g, 0, [&dfs_order](int node) {
+            dfs_order.push_back(node);
+        }, workspace);
+        assert((dfs_order == std::vector<int>{0, 1, 3, 4, 2}));
+
+        std::vector<int> recursive_order;
+        algorithms::graph::dfs_recursive(g, 5, [&recursive_order](int node) {
+            recursive_order.push_back(node);
+        }, workspace);
+        assert((recursive_order == std::vector<int>{5, 4}));
+
+        std::vector<int> complete_bfs;
+        algorithms::graph::bfs_complete(g, [&complete_bfs](int node) {
+            complete_bfs.push_back(node);
+        }, workspace);
+        assert((complete_bfs == std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+        std::vector<int> complete_dfs;
+        algorithms::graph::dfs_complete(g, [&complete_dfs](int node) {
+            complete_dfs.push_back(node);
+        }, workspace);
+        assert((complete_dfs == std::vector<int>{0, 1, 3, 4, 2, 5}));
+
+        std::vector<int> post_order;
+        algorithms::graph::dfs_pre_post_order(g, 0, [](int) {}, [&post_order](int node) {
+            post_order.push_back(node);
+        }, workspace);
+        assert((post_order == std::vector<int>{3, 4, 1, 2, 0}));
+
+        std::size_t levels = 0;
+        algorithms::graph::bfs_by_level(g, 0, [](int) {}, [&levels](std::size_t depth, std::span<const int>) {
+            levels = depth + 1;
+            return depth < 1;
+        }, workspace);
+        assert(levels == 2);
+    }
+
+    // Steady state: repeated traversals keep the same buffers
+    algorithms::graph::bfs_iterative(g, 0, [](int) {}, workspace);
+    [[maybe_unused]] const auto* frontier_data = workspace.frontier().data();
+    [[maybe_unused]] const auto* next_data = workspace.next_frontier().data();
+    algorithms::graph::bfs_iterative(g, 0, [](int) {}, workspace);
+    assert(workspace.frontier().data() == frontier_data || workspace.frontier().data() == next_data);
+    [[maybe_unused]] const auto stack_capacity = workspace.dfs_stack().capacity();
+    algorithms::graph::dfs_iterative(g, 0, [](int) {}, workspace);
+    assert(workspace.dfs_stack().capacity() == stack_capacity);
+    assert(workspace.dfs_stack().empty());
+
+    std::cout << "Traversal workspace reuse tests passed." << std::endl;
+}
+
+void test_workspace_hash_fallback() {
+    struct named_graph {
+        using NodeType = std::string;
+        std::unordered_map<std::string, std::vector<std::string>> adj_list;
+        std::vector<std::string> get_neighbors(const std::string& node) const {
+            auto it = adj_list.find(node);
+            return it == adj_list.end() ? std::vector<std::string>{} : it->second;
+        }
+        std::vector<std::string> get_all_nodes() const {
+            return {"a", "b", "c"};
+        }
+    };
+    named_graph g;
+    g.adj_list["a"] = {"b", "c"};
+    g.adj_list["b"] = {"a"};
+
+    algorithms::graph::TraversalWorkspace<named_graph> workspace;
+    static_assert(std::is_same_v<decltype(workspace)::VisitedSet, algorithms::graph::HashVisitedSet<std::string>>);
+    for (int round = 0; round < 2; ++round) {
+        std::vector<std::string> order;
+        algorithms::graph::bfs_iterative(g, "a", [&order](const std::string& node) {
+            order.push_back(node);
+        }, workspace);
+        assert((order == std::vector<std::string>{"a", "b", "c"}));
+    }
+
+    std::cout << "Traversal workspace hash fallback tests passed." << std::endl;
+}
+
+void test_pmr_workspace() {
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {3, 0}, {5, 4}};
+    Graph g(6, edges);
+
+    // Every buffer of the workspace must come from the arena: it has no upstream
+    alignas(std::max_align_t) std::byte storage[4096];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+    algorithms::graph::PmrTraversalWorkspace<Graph> workspace{std::pmr::polymorphic_allocator<int>(&arena)};
+    static_assert(std::is_same_v<decltype(workspace)::VisitedSet,
+                                 algorithms::graph::EpochVisitedSet<int, std::pmr::polymorphic_allocator<int>>>);
+
+    for (int round = 0; round < 2; ++round) {
+        std::vector<int> bfs_order;
+        algorithms::graph::bfs_iterative(g, 0, [&bfs_order](int node) {
+            bfs_order.push_back(node);
+        }, workspace);
+        assert((bfs_order == std::vector<int>{0, 1, 2, 3, 4}));
+
+        std::vector<int> dfs_order;
+        algorithms::graph::dfs_complete(g, [&dfs_order](int node) {
+            dfs_order.push_back(node);
+        }, workspace);
+        assert((dfs_order == std::vector<int>{0, 1, 3, 4, 2, 5}));
+    }
+    assert(workspace.frontier().get_allocator().resource() == &arena);
+
+    std::cout << "PMR traversal workspace tests passed." << std::endl;
+}
+
+int main() {
+    test_epoch_visited_set();
+    test_workspace_reuse();
+    test_workspace_hash_fallback();
+    test_pmr_workspace();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+
+#include "graph/visited_set.hpp"
+#include <string>
+#include <vector>
+#include <cassert>
+
+void test_bitset_visited_set() {
+    algorithms::graph::BitsetVisitedSet<int> visited(130);
+    assert(!visited.contains(0));
+    assert(visited.insert(0));
+    assert(!visited.insert(0));
+    assert(visited.contains(0));
+
+    assert(visited.insert(63));
+    assert(visited.insert(64));
+    assert(visited.insert(129));
+    assert(visited.contains(63) && visited.contains(64) && visited.contains(129));
+    assert(!visited.contains(62) && !visited.contains(65) && !visited.contains(128));
+
+    std::cout << "Bitset visited set tests passed." << std::endl;
+}
+
+void test_hash_visited_set() {
+    algorithms::graph::HashVisitedSet<std::string> visited;
+    assert(!visited.contains("a"));
+    assert(visited.insert("a"));
+    assert(!visited.insert("a"));
+    assert(visited.contains("a"));
+    assert(!visited.contains("b"));
+
+    std::cout << "Hash visited set tests passed." << std::endl;
+}
+
+void test_make_visited_set() {
+    struct plain_graph {
+        using NodeType = int;
+        std::vector<int> get_neighbors(int) const { return {}; }
+        std::vector<int> get_all_nodes() const { return {}; }
+    };
+    struct indexed_graph {
+        using NodeType = int;
+        std::vector<int> get_neighbors(int) const { return {}; }
+        std::vector<int> get_all_nodes() const { return {}; }
+        std::size_t node_count() const { return 10; }
+    };
+
+    auto plain = algorithms::graph::make_visited_set(plain_graph{});
+    auto indexed = algorithms::graph::make_visited_set(indexed_graph{});
+    static_assert(std::is_same_v<decltype(plain), algorithms::graph::HashVisitedSet<int>>);
+    static_assert(std::is_same_v<decltype(indexed), algorithms::graph::BitsetVisitedSet<int>>);
+    assert(indexed.insert(9));
+    assert(indexed.contains(9));
+
+    std::cout << "make_visited_set tests passed." << std::endl;
+}
+
+int main() {
+    test_bitset_visited_set();
+    test_hash_visited_set();
+    test_make_visited_set();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <iostream>
+
+#include "searching/batched_search.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <cassert>
+
+void test_batched_lower_bound() {
+    std::mt19937 rng(1);
+    for (std::size_t size : {0, 1, 2, 17, 1000, 65536}) {
+        std::vector<int> sorted(size);
+        for (auto& v : sorted) v = static_cast<int>(rng() % 5000);
+        std::sort(sorted.begin(), sorted.end());
+
+        // Query counts around the group width, in random order
+        for (std::size_t query_count : {0, 1, 15, 16, 17, 100}) {
+            std::vector<int> queries(query_count);
+            for (auto& q : queries) q = static_cast<int>(rng() % 5002) - 1;
+
+            std::vector<std::vector<int>::const_iterator> results;
+            algorithms::searching::batched_lower_bound(sorted.cbegin(), sorted.cend(), queries,
+                                                       std::back_inserter(results));
+            assert(results.size() == query_count);
+            for (std::size_t i = 0; i < query_count; ++i) {
+                assert(results[i] == std::lower_bound(sorted.cbegin(), sorted.cend(), queries[i]));
+            }
+        }
+    }
+
+    std::vector<int> desc = {9, 7, 7, 5, 3, 1};
+    std::vector<int> queries = {7, 0, 10, 4};
+    std::vector<std::vector<int>::iterator> results(queries.size());
+    [[maybe_unused]] auto end = algorithms::searching::batched_lower_bound(desc.begin(), desc.end(), queries, results.begin(),
+                                                          std::greater<>());
+    assert(end == results.end());
+    assert(results[0] == desc.begin() + 1 && results[1] == desc.end());
+    assert(results[2] == desc.begin() && results[3] == desc.begin() + 4);
+
+    std::cout << "Batched lower bound test passed!" << std::endl;
+}
+
+void test_batched_equal_range() {
+    std::mt19937 rng(2);
+    std::vector<int> sorted(4000);
+    for (auto& v : sorted) v = static_cast<int>(rng() % 300);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<int> queries(50);
+    for (auto& q : queries) q = static_cast<int>(rng() % 310);
+
+    using Range = std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>;
+    std::vector<Range> ranges;
+    algorithms::searching::batched_equal_range(sorted.cbegin(), sorted.cend(), queries, std::back_inserter(ranges));
+    assert(ranges.size() == queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        assert(ranges[i] == std::equal_range(sorted.cbegin(), sorted.cend(), queries[i]));
+    }
+
+    std::cout << "Batched equal range test passed!" << std::endl;
+}
+
+void test_batched_lower_bound_sorted() {
+    std::mt19937 rng(3);
+    for (std::size_t size : {0, 1, 5, 1000, 100000}) {
+        std::vector<int> sorted(size);
+        for (auto& v : sorted) v = static_cast<int>(rng() % 200000);
+        std::sort(sorted.begin(), sorted.end());
+
+        // Dense, sparse and duplicated sorted queries
+        for (std::size_t query_count : {1, 10, 3000}) {
+            std::vector<int> queries(query_count);
+            for (auto& q : queries) q = static_cast<int>(rng() % 200002) - 1;
+            std::sort(queries.begin(), queries.end());
+            queries.push_back(queries.back());
+
+            std::vector<std::vector<int>::const_iterator> results;
+            algorithms::searching::batched_lower_bound_sorted(sorted.cbegin(), sorted.cend(), queries,
+                                                              std::back_inserter(results));
+            assert(results.size() == queries.size());
+            for (std::size_t i = 0; i < queries.size(); ++i) {
+                assert(results[i] == std::lower_bound(sorted.cbegin(), sorted.cend(), queries[i]));
+            }
+        }
+    }
+
+    std::cout << "Sorted batched lower bound test passed!" << std::endl;
+}
+
+int main() {
+    test_batched_lower_bound();
+    test_batched_equal_range();
+    test_batched_lower_bound_sorted();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
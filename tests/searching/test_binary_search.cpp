@@ -3,6 +3,10 @@
 #include "searching/binary_search.hpp"
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <functional>
+#include <random>
+#include <string_view>
 #include <cassert>
 
 void test_basic_binary_search() {
@@ -42,9 +46,88 @@ void test_equal_range() {
     std::cout << "Equal range tests passed." << std::endl;
 }
 
+void test_lower_upper_bound() {
+    std::mt19937 rng(1);
+    for (std::size_t size = 0; size < 70; ++size) {
+        std::vector<int> vec(size);
+        for (auto& v : vec) v = static_cast<int>(rng() % 20);
+        std::sort(vec.begin(), vec.end());
+
+        for (int value = -1; value <= 21; ++value) {
+            assert(algorithms::searching::lower_bound(vec.begin(), vec.end(), value) ==
+                   std::lower_bound(vec.begin(), vec.end(), value));
+            assert(algorithms::searching::upper_bound(vec.begin(), vec.end(), value) ==
+                   std::upper_bound(vec.begin(), vec.end(), value));
+
+            [[maybe_unused]] auto range = algorithms::searching::equal_range(vec.begin(), vec.end(), value);
+            assert(range == std::equal_range(vec.begin(), vec.end(), value));
+
+            [[maybe_unused]] auto it = algorithms::searching::binary_search(vec.begin(), vec.end(), value);
+            auto lower = std::lower_bound(vec.begin(), vec.end(), value);
+            if (lower != vec.end() && *lower == value) {
+                assert(it == lower);
+            } else {
+                assert(it == vec.end());
+            }
+        }
+    }
+
+    std::vector<int> desc = {9, 7, 7, 5, 3, 1};
+    assert(algorithms::searching::lower_bound(desc.begin(), desc.end(), 7, std::greater<>()) == desc.begin() + 1);
+    assert(algorithms::searching::upper_bound(desc.begin(), desc.end(), 7, std::greater<>()) == desc.begin() + 3);
+    [[maybe_unused]] auto [first, last] = algorithms::searching::equal_range(desc.begin(), desc.end(), 7, std::greater<>());
+    assert(first == desc.begin() + 1 && last == desc.begin() + 3);
+
+    std::cout << "Lower and upper bound tests passed." << std::endl;
+}
+
+constexpr bool constexpr_bounds() {
+    std::array<int, 6> data = {1, 3, 5, 5, 5, 7};
+    auto range = algorithms::searching::equal_range(data.begin(), data.end(), 5);
+    return algorithms::searching::lower_bound(data.begin(), data.end(), 4) == data.begin() + 2 &&
+           algorithms::searching::upper_bound(data.begin(), data.end(), 5) == data.begin() + 5 &&
+           range.first == data.begin() + 2 && range.second == data.begin() + 5;
+}
+
+void test_constexpr_bounds() {
+    static_assert(constexpr_bounds());
+    std::cout << "Constexpr bound tests passed." << std::endl;
+}
+
+void test_binary_search_instrumented() {
+    std::vector<int> data(1000);
+    for (int i = 0; i < 1000; ++i) data[i] = 2 * i;
+
+    std::vector<std::string_view> reports;
+    algorithms::utils::InstrumentationCounters reported;
+    algorithms::utils::CountingInstrumentation metrics(
+        [&](std::string_view algorithm, const algorithms::utils::InstrumentationCounters& counters) {
+            reports.push_back(algorithm);
+            reported = counters;
+        });
+
+    auto it = algorithms::searching::binary_search(data.begin(), data.end(), 642, std::less<>{}, metrics);
+    assert(it != data.end() && *it == 642);
+    assert(reports.size() == 1 && reports[0] == "binary_search");
+    // ceil(log2(1000)) halving steps, the final lower bound check and the equality check
+    assert(reported.comparisons == 12);
+
+    it = algorithms::searching::binary_search(data.begin(), data.end(), 641, std::less<>{}, metrics);
+    assert(it == data.end());
+    assert(reports.size() == 2 && reported.comparisons == 12);
+
+    [[maybe_unused]] algorithms::utils::NoInstrumentation none;
+    assert(algorithms::searching::binary_search(data.begin(), data.end(), 10, std::less<>{}, none) == data.begin() + 5);
+
+    std::cout << "Binary search instrumentation test passed!" << std::endl;
+}
+
 int main() {
     test_basic_binary_search();
     test_equal_range();
+    test_lower_upper_bound();
+    test_constexpr_bounds();
+    test_binary_search_instrumented();
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include "searching/linear_search.hpp"
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <span>
 #include <cassert>
 
 
@@ -31,9 +36,76 @@ void test_linear_search_with_predicate() {
     std::cout << "Linear search with predicate tests passed." << std::endl;
 }
 
+template<typename T>
+void check_vectorized_search() {
+    // Every match position and every start offset, across the vector and scalar tails
+    for (std::size_t size = 0; size < 300; size += (size < 70 ? 1 : 37)) {
+        std::vector<T> vec(size + 3);
+        for (std::size_t i = 0; i < vec.size(); ++i) vec[i] = static_cast<T>(i % 50 + 1);
+        for (std::size_t offset = 0; offset < 3; ++offset) {
+            std::span<T> range(vec.data() + offset, size);
+            assert(algorithms::searching::linear_search(range.begin(), range.end(), T{0}) == range.end());
+            for (std::size_t pos = 0; pos < size; ++pos) {
+                const T saved = range[pos];
+                range[pos] = T{0};
+                assert(algorithms::searching::linear_search(range.begin(), range.end(), T{0}) == range.begin() + pos);
+                range[pos] = saved;
+            }
+        }
+    }
+}
+
+void test_vectorized_linear_search() {
+    check_vectorized_search<std::int8_t>();
+    check_vectorized_search<std::uint8_t>();
+    check_vectorized_search<std::int16_t>();
+    check_vectorized_search<std::uint32_t>();
+    check_vectorized_search<std::int64_t>();
+    check_vectorized_search<std::uint64_t>();
+    check_vectorized_search<float>();
+    check_vectorized_search<double>();
+
+    // First of several matches; only the high half of a 64-bit value differs
+    std::vector<std::uint64_t> wide(100, 0x1'0000'0005ULL);
+    wide[70] = 5;
+    wide[90] = 5;
+    assert(algorithms::searching::linear_search(wide.begin(), wide.end(), std::uint64_t{5}) == wide.begin() + 70);
+
+    // Floats compare like operator==
+    std::vector<double> doubles(100, 1.0);
+    doubles[40] = std::numeric_limits<double>::quiet_NaN();
+    doubles[60] = -0.0;
+    assert(algorithms::searching::linear_search(doubles.begin(), doubles.end(), doubles[40]) == doubles.end());
+    assert(algorithms::searching::linear_search(doubles.begin(), doubles.end(), 0.0) == doubles.begin() + 60);
+
+    // Values of another integer type behave like the element-wise comparison
+    std::vector<std::uint8_t> bytes(100, 7);
+    bytes[80] = 44;
+    assert(algorithms::searching::linear_search(bytes.begin(), bytes.end(), 300) == bytes.end());
+    assert(algorithms::searching::linear_search(bytes.begin(), bytes.end(), 44) == bytes.begin() + 80);
+    std::vector<std::uint32_t> words(100, 1);
+    words[50] = std::numeric_limits<std::uint32_t>::max();
+    assert(algorithms::searching::linear_search(words.begin(), words.end(), std::numeric_limits<std::uint32_t>::max())
+           == words.begin() + 50);
+
+    // Non-contiguous ranges take the generic loop
+    std::deque<int> deque(100, 1);
+    deque[64] = 2;
+    assert(algorithms::searching::linear_search(deque.begin(), deque.end(), 2) == deque.begin() + 64);
+
+    std::cout << "Vectorized linear search tests passed." << std::endl;
+}
+
+constexpr bool constexpr_linear_search() {
+    std::array<int, 5> data = {4, 8, 15, 16, 23};
+    return algorithms::searching::linear_search(data.begin(), data.end(), 15) == data.begin() + 2;
+}
+
 int main() {
     test_basic_linear_search();
     test_linear_search_with_predicate();
+    test_vectorized_linear_search();
+    static_assert(constexpr_linear_search());
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
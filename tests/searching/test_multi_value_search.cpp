@@ -0,0 +1,163 @@
+#include <iostream>
+
+#include "searching/multi_value_search.hpp"
+#include <vector>
+#include <list>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+template<typename Container, typename Values>
+std::vector<std::size_t> expected_positions(const Container& data, const Values& values) {
+    std::vector<std::size_t> positions;
+    std::size_t index = 0;
+    for (const auto& x : data) {
+        for (const auto& v : values) {
+            if (x == v) {
+                positions.push_back(index);
+                break;
+            }
+        }
+        ++index;
+    }
+    return positions;
+}
+
+template<typename T>
+void check_random(std::size_t set_size) {
+    std::mt19937 rng(static_cast<unsigned>(set_size));
+    for (std::size_t size : {0, 1, 7, 33, 1000, 4099}) {
+        std::vector<T> data(size);
+        for (auto& x : data) x = static_cast<T>(rng() % 64);
+        std::vector<T> values(set_size);
+        for (auto& v : values) v = static_cast<T>(rng() % 64);
+
+        std::vector<std::size_t> positions;
+        algorithms::searching::find_all_of(data.begin(), data.end(), values, std::back_inserter(positions));
+        assert(positions == expected_positions(data, values));
+    }
+}
+
+void test_find_all_of() {
+    // Small sets take the compare path, larger ones the hash probe
+    for (std::size_t k : {1, 2, 3, 8, 9, 40}) {
+        check_random<std::int8_t>(k);
+        check_random<std::uint16_t>(k);
+        check_random<int>(k);
+        check_random<std::int64_t>(k);
+        check_random<float>(k);
+        check_random<double>(k);
+    }
+
+    std::vector<int> vec = {5, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<std::size_t> positions;
+    algorithms::searching::find_all_of(vec.begin(), vec.end(), std::array{1, 9}, std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{1, 3, 5}));
+
+    positions.clear();
+    algorithms::searching::find_all_of(vec.begin(), vec.end(), std::vector<int>{}, std::back_inserter(positions));
+    assert(positions.empty());
+
+    std::cout << "Find all of test passed!" << std::endl;
+}
+
+void test_find_all_of_types() {
+    // Forward iterators and non-arithmetic elements use the scalar and hash probes
+    std::list<std::string> words = {"red", "green", "blue", "green", "cyan"};
+    std::vector<std::size_t> positions;
+    algorithms::searching::find_all_of(words.begin(), words.end(), std::vector<std::string>{"green", "cyan"},
+                                       std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{1, 3, 4}));
+
+    // Without std::hash, large sets fall back to a sorted probe
+    struct Key {
+        int value;
+        bool operator==(const Key&) const = default;
+        auto operator<=>(const Key&) const = default;
+    };
+    std::vector<Key> keys;
+    for (int i = 0; i < 100; ++i) keys.push_back({i % 30});
+    std::vector<Key> wanted;
+    for (int i = 0; i < 20; i += 2) wanted.push_back({i});
+    positions.clear();
+    algorithms::searching::find_all_of(keys.begin(), keys.end(), wanted, std::back_inserter(positions));
+    assert(positions == expected_positions(keys, wanted));
+
+    // Values the element type cannot represent never match
+    std::vector<std::uint8_t> bytes = {0, 1, 44, 255};
+    positions.clear();
+    algorithms::searching::find_all_of(bytes.begin(), bytes.end(), std::array{300, 1, -1}, std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{1}));
+
+    // Character types: every position of any of several characters
+    const std::string text = "hello world";
+    positions.clear();
+    algorithms::searching::find_all_of(text.begin(), text.end(), std::vector<char>{'o', 'l'}, std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{2, 3, 4, 7, 9}));
+
+    const std::u32string wide = U"a\u00e9b\U0001F600";
+    positions.clear();
+    algorithms::searching::find_all_of(wide.begin(), wide.end(), std::array{0x1F600, -1, int{'b'}}, std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{2, 3}));
+
+    // Mixed types match only values the element type holds exactly, as element == value would
+    std::vector<int> ints = {1, 2, 3, 2};
+    positions.clear();
+    algorithms::searching::find_all_of(ints.begin(), ints.end(), std::array{2.5, 3.0, 1e30, -1e30},
+                                       std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{2}));
+
+    std::vector<float> floats = {0.1f, 0.5f};
+    positions.clear();
+    algorithms::searching::find_all_of(floats.begin(), floats.end(), std::array{0.1, 0.5, 1e300},
+                                       std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{1}));
+
+    std::vector<double> doubles = {2.0, 2.5};
+    positions.clear();
+    algorithms::searching::find_all_of(doubles.begin(), doubles.end(), std::array<std::int64_t, 2>{2, INT64_MAX},
+                                       std::back_inserter(positions));
+    assert((positions == std::vector<std::size_t>{0}));
+
+    std::cout << "Find all of types test passed!" << std::endl;
+}
+
+void test_find_all_of_bitmap() {
+    std::vector<int> vec(130, 0);
+    vec[0] = 3;
+    vec[63] = 7;
+    vec[64] = 3;
+    vec[129] = 7;
+
+    std::vector<std::uint64_t> bitmap(3, ~std::uint64_t{0});
+    [[maybe_unused]] std::size_t matches = algorithms::searching::find_all_of(vec.begin(), vec.end(), std::array{3, 7},
+                                                             std::span<std::uint64_t>(bitmap));
+    assert(matches == 4);
+    assert(bitmap[0] == ((std::uint64_t{1} << 63) | 1));
+    assert(bitmap[1] == 1);
+    assert(bitmap[2] == 2);
+
+    std::vector<std::uint64_t> small(2);
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::searching::find_all_of(vec.begin(), vec.end(), std::array{3}, std::span<std::uint64_t>(small));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Find all of bitmap test passed!" << std::endl;
+}
+
+int main() {
+    test_find_all_of();
+    test_find_all_of_types();
+    test_find_all_of_bitmap();
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+
+#include "searching/parallel_linear_search.hpp"
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+void test_parallel_linear_search_if() {
+    std::mt19937 rng(1);
+    for (std::size_t size : {0, 1, 2, 100, 10000, 1000003}) {
+        std::vector<int> vec(size);
+        for (auto& v : vec) v = static_cast<int>(rng() % 1000000);
+
+        for (std::size_t threads : {1, 2, 3, 8}) {
+            [[maybe_unused]] const algorithms::utils::ParallelPolicy policy{threads};
+            for (int threshold : {999990, 999999, 1000000}) {
+                auto pred = [threshold](int x) { return x >= threshold; };
+                [[maybe_unused]] auto expected = std::find_if(vec.begin(), vec.end(), pred);
+                assert(algorithms::searching::linear_search_if(policy, vec.begin(), vec.end(), pred) == expected);
+            }
+        }
+    }
+
+    std::cout << "Parallel linear search test passed!" << std::endl;
+}
+
+void test_parallel_linear_search_first_match() {
+    // Many matches spread over the range: the earliest one must win,
+    // even when a later chunk finds its match first
+    std::vector<int> vec(500000, 0);
+    for (std::size_t i = 123457; i < vec.size(); i += 1000) vec[i] = 1;
+    vec[vec.size() - 1] = 1;
+    for (int round = 0; round < 20; ++round) {
+        [[maybe_unused]] auto it = algorithms::searching::linear_search_if(algorithms::utils::ParallelPolicy{8}, vec.begin(), vec.end(),
+                                                          [](int x) { return x == 1; });
+        assert(it == vec.begin() + 123457);
+    }
+
+    // Cancellation: a match at the front leaves most of the range unexamined
+    std::vector<int> front(1 << 20, 0);
+    front[10] = 1;
+    std::atomic<std::size_t> calls{0};
+    [[maybe_unused]] auto it = algorithms::searching::linear_search_if(algorithms::utils::ParallelPolicy{4}, front.begin(), front.end(),
+                                                      [&calls](int x) { ++calls; return x == 1; });
+    assert(it == front.begin() + 10);
+    assert(calls.load() < front.size() / 2);
+
+    std::vector<std::string> lines = {"info", "debug", "error: disk", "error: net"};
+    [[maybe_unused]] auto line = algorithms::searching::linear_search_if(algorithms::utils::ParallelPolicy{2}, lines.begin(), lines.end(),
+                                                        [](const std::string& s) { return s.rfind("error", 0) == 0; });
+    assert(line == lines.begin() + 2);
+
+    std::cout << "Parallel linear search first match test passed!" << std::endl;
+}
+
+void test_parallel_linear_search_exception() {
+    std::vector<int> vec(100000, 0);
+    [[maybe_unused]] bool threw = false;
+    try {
+        algorithms::searching::linear_search_if(algorithms::utils::ParallelPolicy{4}, vec.begin(), vec.end(),
+                                                [](int) -> bool { throw std::runtime_error("predicate failed"); });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "Parallel linear search exception test passed!" << std::endl;
+}
+
+int main() {
+    test_parallel_linear_search_if();
+    test_parallel_linear_search_first_match();
+    test_parallel_linear_search_exception();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
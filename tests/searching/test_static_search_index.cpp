@@ -0,0 +1,83 @@
+#include <iostream>
+
+#include "searching/static_search_index.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+void test_static_search_index() {
+    std::mt19937 rng(1);
+    for (std::size_t size = 0; size < 80; ++size) {
+        std::vector<int> sorted(size);
+        for (auto& v : sorted) v = static_cast<int>(rng() % 40);
+        std::sort(sorted.begin(), sorted.end());
+        algorithms::searching::StaticSearchIndex<int> index(sorted.begin(), sorted.end());
+        assert(index.size() == size);
+
+        for (int value = -1; value <= 41; ++value) {
+            auto expected = std::lower_bound(sorted.begin(), sorted.end(), value);
+            [[maybe_unused]] const int* found = index.lower_bound(value);
+            if (expected == sorted.end()) {
+                assert(found == nullptr);
+            } else {
+                assert(found != nullptr && *found == *expected);
+            }
+            [[maybe_unused]] const bool present = std::binary_search(sorted.begin(), sorted.end(), value);
+            assert(index.contains(value) == present);
+            assert((index.find(value) != nullptr) == present);
+        }
+    }
+
+    std::vector<unsigned> keys(100000);
+    for (auto& k : keys) k = static_cast<unsigned>(rng());
+    std::sort(keys.begin(), keys.end());
+    algorithms::searching::StaticSearchIndex<unsigned> index(keys.begin(), keys.end());
+    for (int i = 0; i < 10000; ++i) {
+        const unsigned probe = static_cast<unsigned>(rng());
+        [[maybe_unused]] auto expected = std::lower_bound(keys.begin(), keys.end(), probe);
+        [[maybe_unused]] const unsigned* found = index.lower_bound(probe);
+        assert(expected == keys.end() ? found == nullptr : (found != nullptr && *found == *expected));
+        assert(index.contains(keys[static_cast<std::size_t>(i) * 7]));
+    }
+
+    std::cout << "Static search index test passed!" << std::endl;
+}
+
+void test_static_search_index_compare() {
+    std::vector<int> desc = {9, 7, 7, 5, 3, 1};
+    algorithms::searching::StaticSearchIndex<int, std::greater<>> index(desc.begin(), desc.end());
+    assert(*index.lower_bound(8) == 7);
+    assert(*index.lower_bound(100) == 9);
+    assert(index.lower_bound(0) == nullptr);
+    assert(index.contains(5) && !index.contains(4));
+
+    std::vector<std::string> words = {"apple", "banana", "cherry"};
+    algorithms::searching::StaticSearchIndex<std::string> word_index(words.begin(), words.end());
+    assert(*word_index.lower_bound(std::string("b")) == "banana");
+    assert(word_index.find(std::string("cherry")) != nullptr);
+
+    algorithms::searching::StaticSearchIndex<int> empty;
+    assert(empty.empty() && empty.lower_bound(1) == nullptr && !empty.contains(1));
+
+    [[maybe_unused]] bool threw = false;
+    try {
+        std::vector<int> unsorted = {3, 1, 2};
+        algorithms::searching::StaticSearchIndex<int> bad(unsorted.begin(), unsorted.end());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "Static search index comparator test passed!" << std::endl;
+}
+
+int main() {
+    test_static_search_index();
+    test_static_search_index_compare();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
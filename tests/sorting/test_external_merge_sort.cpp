@@ -0,0 +1,164 @@
+#include <iostream>
+
+#include "sorting/external_merge_sort.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+namespace fs = std::filesystem;
+
+struct Record {
+    std::uint32_t key;
+    std::uint32_t sequence;
+};
+
+template<typename T>
+void write_file(const fs::path& path, const std::vector<T>& records) {
+    std::FILE* file = std::fopen(path.string().c_str(), "wb");
+    assert(file);
+    if (!records.empty()) std::fwrite(records.data(), sizeof(T), records.size(), file);
+    std::fclose(file);
+}
+
+template<typename T>
+std::vector<T> read_file(const fs::path& path) {
+    std::vector<T> records(fs::file_size(path) / sizeof(T));
+    std::FILE* file = std::fopen(path.string().c_str(), "rb");
+    assert(file);
+    if (!records.empty()) {
+        [[maybe_unused]] const std::size_t count = std::fread(records.data(), sizeof(T), records.size(), file);
+        assert(count == records.size());
+    }
+    std::fclose(file);
+    return records;
+}
+
+fs::path make_temp_dir(const std::string& name) {
+    auto dir = fs::temp_directory_path() / name;
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+void test_external_merge_sort() {
+    const auto dir = make_temp_dir("algorithms_external_sort_test");
+    std::mt19937_64 rng(1);
+
+    // 100k records with room for 1000 per run and a fan-in of 4: several merge passes
+    std::vector<std::uint64_t> values(100000);
+    for (auto& v : values) v = rng();
+    write_file(dir / "input.bin", values);
+
+    algorithms::sorting::ExternalSortOptions options;
+    options.memory_budget = 2000 * sizeof(std::uint64_t);
+    options.fan_in = 4;
+    options.temp_directory = dir;
+    algorithms::sorting::external_merge_sort<std::uint64_t>(dir / "input.bin", dir / "output.bin", std::less<>(), options);
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    assert(read_file<std::uint64_t>(dir / "output.bin") == expected);
+
+    // Only input and output remain: every run file was removed
+    assert(std::distance(fs::directory_iterator(dir), fs::directory_iterator()) == 2);
+
+    // Descending order with the default options (a single in-memory run)
+    algorithms::sorting::external_merge_sort<std::uint64_t>(dir / "input.bin", dir / "desc.bin", std::greater<>());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    assert(read_file<std::uint64_t>(dir / "desc.bin") == expected);
+
+    fs::remove_all(dir);
+    std::cout << "External merge sort test passed!" << std::endl;
+}
+
+void test_external_merge_sort_stable() {
+    const auto dir = make_temp_dir("algorithms_external_sort_stable_test");
+    std::mt19937 rng(2);
+
+    std::vector<Record> records(30000);
+    for (std::uint32_t i = 0; i < records.size(); ++i) {
+        records[i] = {static_cast<std::uint32_t>(rng() % 20), i};
+    }
+    write_file(dir / "input.bin", records);
+
+    algorithms::sorting::ExternalSortOptions options;
+    options.memory_budget = 512 * sizeof(Record);
+    options.fan_in = 3;
+    options.temp_directory = dir;
+    auto by_key = [](const Record& a, const Record& b) { return a.key < b.key; };
+    algorithms::sorting::external_merge_sort<Record>(dir / "input.bin", dir / "output.bin", by_key, options);
+
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+    const auto sorted = read_file<Record>(dir / "output.bin");
+    assert(sorted.size() == expected.size());
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        assert(sorted[i].key == expected[i].key && sorted[i].sequence == expected[i].sequence);
+    }
+
+    fs::remove_all(dir);
+    std::cout << "External merge sort stability test passed!" << std::endl;
+}
+
+void test_external_merge_sort_edge_cases() {
+    const auto dir = make_temp_dir("algorithms_external_sort_edge_test");
+
+    write_file(dir / "empty.bin", std::vector<std::uint32_t>{});
+    algorithms::sorting::external_merge_sort<std::uint32_t>(dir / "empty.bin", dir / "empty_out.bin");
+    assert(fs::exists(dir / "empty_out.bin") && fs::file_size(dir / "empty_out.bin") == 0);
+
+    // Exactly one full run
+    algorithms::sorting::ExternalSortOptions options;
+    options.memory_budget = 8 * sizeof(std::uint32_t);
+    options.fan_in = 2;
+    options.temp_directory = dir;
+    write_file(dir / "four.bin", std::vector<std::uint32_t>{4, 2, 3, 1});
+    algorithms::sorting::external_merge_sort<std::uint32_t>(dir / "four.bin", dir / "four_out.bin", std::less<>(), options);
+    assert((read_file<std::uint32_t>(dir / "four_out.bin") == std::vector<std::uint32_t>{1, 2, 3, 4}));
+
+    [[maybe_unused]] bool threw = false;
+    try {
+        options.fan_in = 1;
+        algorithms::sorting::external_merge_sort<std::uint32_t>(dir / "four.bin", dir / "bad.bin", std::less<>(), options);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        options.fan_in = 2;
+        options.memory_budget = sizeof(std::uint32_t);
+        algorithms::sorting::external_merge_sort<std::uint32_t>(dir / "four.bin", dir / "bad.bin", std::less<>(), options);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // A file that is not a whole number of records
+    write_file(dir / "ragged.bin", std::vector<std::uint8_t>{1, 2, 3});
+    threw = false;
+    try {
+        algorithms::sorting::external_merge_sort<std::uint32_t>(dir / "ragged.bin", dir / "bad.bin");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    fs::remove_all(dir);
+    std::cout << "External merge sort edge cases test passed!" << std::endl;
+}
+
+int main() {
+    test_external_merge_sort();
+    test_external_merge_sort_stable();
+    test_external_merge_sort_edge_cases();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
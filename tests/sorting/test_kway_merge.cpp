@@ -0,0 +1,127 @@
+#include <iostream>
+
+#include "sorting/kway_merge.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <cassert>
+
+void test_kway_merge() {
+    std::vector<std::vector<int>> shards = {{1, 4, 7}, {2, 5}, {3, 6, 8}};
+    std::vector<int> merged;
+    algorithms::sorting::kway_merge(shards, std::back_inserter(merged));
+    assert((merged == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+    // No inputs, empty inputs and a single input
+    std::vector<std::vector<int>> none;
+    merged.clear();
+    algorithms::sorting::kway_merge(none, std::back_inserter(merged));
+    assert(merged.empty());
+
+    std::vector<std::vector<int>> sparse = {{}, {3}, {}, {1, 2}, {}};
+    merged.clear();
+    algorithms::sorting::kway_merge(sparse, std::back_inserter(merged));
+    assert((merged == std::vector<int>{1, 2, 3}));
+
+    std::vector<std::vector<int>> single = {{1, 2, 3}};
+    merged.clear();
+    algorithms::sorting::kway_merge(single, std::back_inserter(merged));
+    assert((merged == std::vector<int>{1, 2, 3}));
+
+    // Many shards of random sizes, including non powers of two
+    std::mt19937 rng(1);
+    for (std::size_t k : {2, 3, 5, 16, 33}) {
+        std::vector<std::vector<int>> inputs(k);
+        std::vector<int> expected;
+        for (auto& input : inputs) {
+            input.resize(rng() % 200);
+            for (auto& v : input) v = static_cast<int>(rng() % 1000);
+            std::sort(input.begin(), input.end());
+            expected.insert(expected.end(), input.begin(), input.end());
+        }
+        std::sort(expected.begin(), expected.end());
+        std::vector<int> out(expected.size());
+        [[maybe_unused]] auto end = algorithms::sorting::kway_merge(inputs, out.begin());
+        assert(end == out.end());
+        assert(out == expected);
+    }
+
+    std::cout << "K-way merge test passed!" << std::endl;
+}
+
+void test_kway_merge_comparators() {
+    std::vector<std::vector<int>> desc = {{9, 5, 1}, {8, 2}, {7, 6, 3}};
+    std::vector<int> merged;
+    algorithms::sorting::kway_merge(desc, std::back_inserter(merged), std::greater<>());
+    assert((merged == std::vector<int>{9, 8, 7, 6, 5, 3, 2, 1}));
+
+    // Spans over existing storage and non-random-access inputs work as well
+    std::vector<int> storage = {1, 3, 5, 2, 4, 6};
+    std::vector<std::span<const int>> halves = {std::span<const int>(storage).first(3),
+                                                std::span<const int>(storage).last(3)};
+    merged.clear();
+    algorithms::sorting::kway_merge(halves, std::back_inserter(merged));
+    assert((merged == std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+    std::vector<std::list<std::string>> lists = {{"apple", "cherry"}, {"banana"}, {"date"}};
+    std::vector<std::string> words;
+    algorithms::sorting::kway_merge(lists, std::back_inserter(words));
+    assert((words == std::vector<std::string>{"apple", "banana", "cherry", "date"}));
+
+    std::cout << "K-way merge comparators test passed!" << std::endl;
+}
+
+void test_kway_merge_stable() {
+    // Equal keys come out in input order: first by shard, then by position
+    using Item = std::pair<int, int>;
+    std::vector<std::vector<Item>> shards = {
+        {{1, 0}, {2, 1}, {2, 2}},
+        {{1, 10}, {2, 11}},
+        {{2, 20}, {3, 21}},
+    };
+    std::vector<Item> merged;
+    algorithms::sorting::kway_merge(shards, std::back_inserter(merged),
+                                    [](const Item& a, const Item& b) { return a.first < b.first; });
+    std::vector<Item> expected = {{1, 0}, {1, 10}, {2, 1}, {2, 2}, {2, 11}, {2, 20}, {3, 21}};
+    assert(merged == expected);
+
+    std::cout << "K-way merge stability test passed!" << std::endl;
+}
+
+void test_kway_merge_lazy() {
+    std::vector<std::vector<int>> shards = {{1, 4, 9}, {2, 3, 10}, {5}};
+    auto merged = algorithms::sorting::make_kway_merge(shards);
+
+    // Pull only as much as needed
+    std::vector<int> prefix;
+    std::vector<std::size_t> sources;
+    while (!merged.empty() && merged.front() < 5) {
+        prefix.push_back(merged.front());
+        sources.push_back(merged.winner_source());
+        merged.pop();
+    }
+    assert((prefix == std::vector<int>{1, 2, 3, 4}));
+    assert((sources == std::vector<std::size_t>{0, 1, 1, 0}));
+    assert(merged.front() == 5);
+
+    std::vector<int> rest;
+    for (; !merged.empty(); merged.pop()) rest.push_back(merged.front());
+    assert((rest == std::vector<int>{5, 9, 10}));
+
+    std::cout << "Lazy k-way merge test passed!" << std::endl;
+}
+
+int main() {
+    test_kway_merge();
+    test_kway_merge_comparators();
+    test_kway_merge_stable();
+    test_kway_merge_lazy();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -3,6 +3,16 @@
 #include "sorting/merge_sort.hpp"
 #include <vector>
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <functional>
+#include <string_view>
 #include <cassert>
 
 void test_merge_sort() {
@@ -19,8 +29,207 @@ void test_merge_sort() {
     std::cout << "Merge sort custom comparator test passed!" << std::endl;
 }
 
+void test_merge_sort_bottom_up() {
+    std::mt19937 rng(42);
+    for (std::size_t size : {0, 1, 2, 31, 32, 33, 64, 100, 1000, 4097}) {
+        std::vector<int> vec(size);
+        for (auto& x : vec) x = static_cast<int>(rng() % 100);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        auto sorted = vec;
+        algorithms::sorting::merge_sort_bottom_up(sorted.begin(), sorted.end());
+        assert(sorted == expected);
+
+        // Caller-supplied buffer, larger than needed and reused
+        std::vector<int> scratch(size + 5);
+        sorted = vec;
+        algorithms::sorting::merge_sort_bottom_up(sorted.begin(), sorted.end(), std::less<>{}, std::span<int>(scratch));
+        assert(sorted == expected);
+        sorted = vec;
+        algorithms::sorting::merge_sort_bottom_up(sorted.begin(), sorted.end(), std::less<>{}, std::span<int>(scratch));
+        assert(sorted == expected);
+    }
+
+    std::vector<int> vec = {5, 2, 9, 1, 5, 6};
+    algorithms::sorting::merge_sort_bottom_up(vec.begin(), vec.end(), std::greater<>());
+    assert(std::is_sorted(vec.begin(), vec.end(), std::greater<>()));
+
+    std::vector<int> small_scratch(2);
+    [[maybe_unused]] bool thrown = false;
+    try {
+        algorithms::sorting::merge_sort_bottom_up(vec.begin(), vec.end(), std::less<>{}, std::span<int>(small_scratch));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "Bottom-up merge sort test passed!" << std::endl;
+}
+
+void test_merge_sort_bottom_up_stable() {
+    // Sort by key only; equal keys must keep their original order
+    std::mt19937 rng(7);
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < 2000; ++i) {
+        records.emplace_back(static_cast<int>(rng() % 10), i);
+    }
+    auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    algorithms::sorting::merge_sort_bottom_up(records.begin(), records.end(), by_key);
+    assert(records == expected);
+
+    std::vector<std::string> names = {"carol", "alice", "bob", "alice", "dave"};
+    algorithms::sorting::merge_sort_bottom_up(names.begin(), names.end());
+    assert((names == std::vector<std::string>{"alice", "alice", "bob", "carol", "dave"}));
+
+    std::cout << "Bottom-up merge sort stability test passed!" << std::endl;
+}
+
+void test_merge_sort_stable() {
+    std::mt19937 rng(3);
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < 2000; ++i) {
+        records.emplace_back(static_cast<int>(rng() % 10), i);
+    }
+    auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    algorithms::sorting::merge_sort(records.begin(), records.end(), by_key);
+    assert(records == expected);
+
+    // Two elements with equal keys: the left one must stay first
+    std::vector<std::pair<int, char>> pair = {{1, 'a'}, {1, 'b'}};
+    algorithms::sorting::merge_sort(pair.begin(), pair.end(), by_key);
+    assert(pair[0].second == 'a' && pair[1].second == 'b');
+
+    std::cout << "Merge sort stability test passed!" << std::endl;
+}
+
+void test_merge_sort_move_only() {
+    std::vector<std::unique_ptr<int>> values;
+    for (int v : {5, 3, 9, 1, 3, 7}) {
+        values.push_back(std::make_unique<int>(v));
+    }
+    [[maybe_unused]] const int* first_three = values[1].get();
+    [[maybe_unused]] const int* second_three = values[4].get();
+    auto by_value = [](const auto& a, const auto& b) { return *a < *b; };
+
+    algorithms::sorting::merge_sort(values.begin(), values.end(), by_value);
+
+    std::vector<int> sorted;
+    for (const auto& p : values) sorted.push_back(*p);
+    assert((sorted == std::vector<int>{1, 3, 3, 5, 7, 9}));
+    assert(values[1].get() == first_three && values[2].get() == second_three);
+
+    // The merge step also accepts move iterators as input
+    std::vector<std::unique_ptr<int>> left, right, out;
+    for (int v : {1, 4, 4}) left.push_back(std::make_unique<int>(v));
+    for (int v : {2, 4}) right.push_back(std::make_unique<int>(v));
+    [[maybe_unused]] const int* right_four = right[1].get();
+    algorithms::sorting::detail::move_merge(std::make_move_iterator(left.begin()), std::make_move_iterator(left.end()),
+                                            std::make_move_iterator(right.begin()), std::make_move_iterator(right.end()),
+                                            std::back_inserter(out), by_value);
+    assert(out.size() == 5);
+    assert(*out[0] == 1 && *out[1] == 2 && *out[2] == 4 && *out[3] == 4 && *out[4] == 4);
+    assert(out[4].get() == right_four);
+
+    std::cout << "Merge sort move-only test passed!" << std::endl;
+}
+
+void test_merge_sort_instrumented() {
+    std::vector<int> data = {8, 3, 5, 1, 7, 2, 6, 4};
+    std::vector<int> plain = data;
+    std::size_t plain_comparisons = 0;
+    algorithms::sorting::merge_sort(plain.begin(), plain.end(), [&](int a, int b) {
+        ++plain_comparisons;
+        return a < b;
+    });
+
+    std::vector<std::string> reports;
+    algorithms::utils::InstrumentationCounters reported;
+    algorithms::utils::CountingInstrumentation metrics(
+        [&](std::string_view algorithm, const algorithms::utils::InstrumentationCounters& counters) {
+            reports.emplace_back(algorithm);
+            reported = counters;
+        });
+    algorithms::sorting::merge_sort(data.begin(), data.end(), std::less<>{}, metrics);
+
+    assert(data == plain);
+    assert((reports == std::vector<std::string>{"merge_sort"}));
+    assert(reported.comparisons == plain_comparisons);
+    // 8 elements: 7 merges, each element moved out and back on each of the 3 levels
+    assert(reported.allocations == 7);
+    assert(reported.moves == 2 * 8 * 3);
+    assert(reported.nodes_visited == 0 && reported.edges_examined == 0);
+    // Counters are reset after each report
+    assert(metrics.counters() == algorithms::utils::InstrumentationCounters{});
+
+    // Disabled instrumentation sorts the same way
+    std::vector<int> quiet = {8, 3, 5, 1, 7, 2, 6, 4};
+    algorithms::utils::NoInstrumentation none;
+    algorithms::sorting::merge_sort(quiet.begin(), quiet.end(), std::less<>{}, none);
+    assert(quiet == plain);
+
+    std::cout << "Merge sort instrumentation test passed!" << std::endl;
+}
+
+// Forwards to the default resource, counting the allocations made through it
+struct CountingResource : std::pmr::memory_resource {
+    std::size_t allocations = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+void test_merge_sort_allocator() {
+    std::vector<std::string> expected = {"delta", "alpha", "echo", "charlie", "bravo", "foxtrot"};
+    std::vector<std::string> top_down = expected;
+    std::vector<std::string> bottom_up = expected;
+    std::sort(expected.begin(), expected.end());
+
+    CountingResource resource;
+    algorithms::sorting::merge_sort(top_down.begin(), top_down.end(), std::less<>{},
+                                    std::pmr::polymorphic_allocator<>(&resource));
+    assert(top_down == expected);
+    // One buffer per merge: 6 elements take 5 merges
+    assert(resource.allocations == 5);
+
+    resource.allocations = 0;
+    algorithms::sorting::merge_sort_bottom_up(bottom_up.begin(), bottom_up.end(), std::less<>{},
+                                              std::pmr::polymorphic_allocator<>(&resource));
+    assert(bottom_up == expected);
+    assert(resource.allocations == 1);
+
+    // A monotonic arena on the stack serves the whole sort without touching the heap
+    std::vector<int> data(1000);
+    for (int i = 0; i < 1000; ++i) data[static_cast<std::size_t>(i)] = (i * 7919) % 1000;
+    alignas(std::max_align_t) std::byte storage[8192];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+    algorithms::sorting::merge_sort_bottom_up(data.begin(), data.end(), std::less<>{},
+                                              std::pmr::polymorphic_allocator<>(&arena));
+    assert(std::is_sorted(data.begin(), data.end()));
+
+    std::cout << "Merge sort allocator test passed!" << std::endl;
+}
+
 int main() {
     test_merge_sort();
+    test_merge_sort_stable();
+    test_merge_sort_move_only();
+    test_merge_sort_bottom_up();
+    test_merge_sort_bottom_up_stable();
+    test_merge_sort_instrumented();
+    test_merge_sort_allocator();
     std::cout << "All tests passed." << std::endl;
     return 0;
 }
\ No newline at end of file
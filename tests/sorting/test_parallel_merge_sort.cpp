@@ -0,0 +1,78 @@
+#include <iostream>
+
+#include "sorting/parallel_merge_sort.hpp"
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <cassert>
+
+void test_parallel_merge_sort() {
+    std::mt19937 rng(1);
+    for (std::size_t size : {0, 1, 100, 20000, 100003}) {
+        std::vector<int> vec(size);
+        for (auto& x : vec) x = static_cast<int>(rng());
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        for (std::size_t threads : {1, 2, 3, 4, 8}) {
+            auto sorted = vec;
+            algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{threads}, sorted.begin(), sorted.end());
+            assert(sorted == expected);
+        }
+    }
+
+    std::vector<int> vec(50000);
+    for (auto& x : vec) x = static_cast<int>(rng() % 1000);
+    algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{4}, vec.begin(), vec.end(), std::greater<>());
+    assert(std::is_sorted(vec.begin(), vec.end(), std::greater<>()));
+
+    std::cout << "Parallel merge sort test passed!" << std::endl;
+}
+
+void test_parallel_merge_sort_stable() {
+    // Few distinct keys so that the parallel merge splits land inside runs of ties
+    std::mt19937 rng(2);
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < 80000; ++i) {
+        records.emplace_back(static_cast<int>(rng() % 3), i);
+    }
+    auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{5}, records.begin(), records.end(), by_key);
+    assert(records == expected);
+
+    std::vector<std::string> words(40000);
+    for (auto& w : words) w = std::to_string(rng() % 5000);
+    auto expected_words = words;
+    std::sort(expected_words.begin(), expected_words.end());
+    algorithms::sorting::merge_sort(algorithms::utils::ParallelPolicy{4}, words.begin(), words.end());
+    assert(words == expected_words);
+
+    std::cout << "Parallel merge sort stability test passed!" << std::endl;
+}
+
+void test_merge_path_split() {
+    std::vector<int> left = {1, 3, 3, 5};
+    std::vector<int> right = {2, 3, 4};
+    [[maybe_unused]] std::less<> comp;
+    // Merged: 1 2 3(L) 3(L) 3(R) 4 5
+    assert(algorithms::sorting::detail::merge_path_split(left.begin(), 4, right.begin(), 3, 0, comp) == 0);
+    assert(algorithms::sorting::detail::merge_path_split(left.begin(), 4, right.begin(), 3, 2, comp) == 1);
+    assert(algorithms::sorting::detail::merge_path_split(left.begin(), 4, right.begin(), 3, 4, comp) == 3);
+    assert(algorithms::sorting::detail::merge_path_split(left.begin(), 4, right.begin(), 3, 5, comp) == 3);
+    assert(algorithms::sorting::detail::merge_path_split(left.begin(), 4, right.begin(), 3, 7, comp) == 4);
+
+    std::cout << "Merge path split test passed!" << std::endl;
+}
+
+int main() {
+    test_merge_path_split();
+    test_parallel_merge_sort();
+    test_parallel_merge_sort_stable();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
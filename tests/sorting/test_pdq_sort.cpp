@@ -0,0 +1,121 @@
+#include <iostream>
+
+#include "sorting/pdq_sort.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <cassert>
+
+void test_pdq_sort() {
+    std::vector<int> vec = {64, 34, 25, 12, 22, 11, 90};
+    algorithms::sorting::pdq_sort(vec.begin(), vec.end());
+    assert((vec == std::vector<int>{11, 12, 22, 25, 34, 64, 90}));
+
+    std::vector<int> empty;
+    algorithms::sorting::pdq_sort(empty.begin(), empty.end());
+    assert(empty.empty());
+
+    std::mt19937 rng(1);
+    for (std::size_t size : {1, 2, 23, 24, 25, 129, 1000, 100000}) {
+        std::vector<int> values(size);
+        for (auto& v : values) v = static_cast<int>(rng());
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        algorithms::sorting::pdq_sort(values.begin(), values.end());
+        assert(values == expected);
+    }
+
+    std::cout << "Pdq sort test passed!" << std::endl;
+}
+
+void test_pdq_sort_patterns() {
+    std::mt19937 rng(2);
+    const std::size_t n = 50000;
+    std::vector<std::vector<int>> inputs;
+
+    std::vector<int> ascending(n);
+    std::iota(ascending.begin(), ascending.end(), 0);
+    inputs.push_back(ascending);
+    inputs.emplace_back(ascending.rbegin(), ascending.rend());
+
+    std::vector<int> equal(n, 7);
+    inputs.push_back(equal);
+
+    std::vector<int> few_values(n);
+    for (auto& v : few_values) v = static_cast<int>(rng() % 4);
+    inputs.push_back(few_values);
+
+    // Sorted with a handful of elements out of place
+    auto nearly = ascending;
+    for (int i = 0; i < 10; ++i) std::swap(nearly[rng() % n], nearly[rng() % n]);
+    inputs.push_back(nearly);
+
+    // Organ pipe and sawtooth, classic quicksort killers for naive pivots
+    std::vector<int> organ(n);
+    for (std::size_t i = 0; i < n; ++i) organ[i] = static_cast<int>(i < n / 2 ? i : n - i);
+    inputs.push_back(organ);
+    std::vector<int> saw(n);
+    for (std::size_t i = 0; i < n; ++i) saw[i] = static_cast<int>(i % 100);
+    inputs.push_back(saw);
+
+    // Ascending then descending tail, so the reverse fast path must not trigger
+    auto tail = ascending;
+    std::reverse(tail.begin() + n / 2, tail.end());
+    inputs.push_back(tail);
+
+    for (auto& input : inputs) {
+        auto expected = input;
+        std::sort(expected.begin(), expected.end());
+        algorithms::sorting::pdq_sort(input.begin(), input.end());
+        assert(input == expected);
+    }
+
+    std::cout << "Pdq sort patterns test passed!" << std::endl;
+}
+
+void test_pdq_sort_comparators() {
+    std::mt19937 rng(3);
+
+    // Arithmetic types with standard functors take the branchless partition
+    std::vector<double> doubles(20000);
+    for (auto& d : doubles) d = static_cast<double>(rng() % 1000) / 7.0;
+    algorithms::sorting::pdq_sort(doubles.begin(), doubles.end(), std::greater<>());
+    assert(std::is_sorted(doubles.begin(), doubles.end(), std::greater<>()));
+
+    std::vector<unsigned> unsigneds(20000);
+    for (auto& u : unsigneds) u = static_cast<unsigned>(rng());
+    algorithms::sorting::pdq_sort(unsigneds.begin(), unsigneds.end(), std::less<unsigned>());
+    assert(std::is_sorted(unsigneds.begin(), unsigneds.end()));
+
+    // Custom comparator and non-arithmetic types take the classic partition
+    std::vector<std::string> words(5000);
+    for (auto& w : words) w = std::to_string(rng() % 10000);
+    auto expected = words;
+    auto by_length = [](const std::string& a, const std::string& b) {
+        return a.size() != b.size() ? a.size() < b.size() : a < b;
+    };
+    std::sort(expected.begin(), expected.end(), by_length);
+    algorithms::sorting::pdq_sort(words.begin(), words.end(), by_length);
+    assert(words == expected);
+
+    std::vector<std::unique_ptr<int>> boxed;
+    for (int i = 0; i < 1000; ++i) boxed.push_back(std::make_unique<int>(static_cast<int>(rng() % 100)));
+    auto by_value = [](const auto& a, const auto& b) { return *a < *b; };
+    algorithms::sorting::pdq_sort(boxed.begin(), boxed.end(), by_value);
+    assert(std::is_sorted(boxed.begin(), boxed.end(), by_value));
+
+    std::cout << "Pdq sort comparators test passed!" << std::endl;
+}
+
+int main() {
+    test_pdq_sort();
+    test_pdq_sort_patterns();
+    test_pdq_sort_comparators();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+
+#include "sorting/radix_sort.hpp"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <utility>
+#include <cassert>
+
+void test_radix_sort_unsigned() {
+    std::mt19937_64 rng(1);
+    for (std::size_t size : {0, 1, 10, 63, 64, 1000, 100000}) {
+        std::vector<std::uint32_t> values(size);
+        for (auto& v : values) v = static_cast<std::uint32_t>(rng());
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        algorithms::sorting::radix_sort(values.begin(), values.end());
+        assert(values == expected);
+    }
+
+    std::vector<std::uint64_t> wide(5000);
+    for (auto& v : wide) v = rng();
+    auto expected = wide;
+    std::sort(expected.begin(), expected.end());
+    algorithms::sorting::radix_sort(wide.begin(), wide.end());
+    assert(wide == expected);
+
+    std::cout << "Radix sort unsigned test passed!" << std::endl;
+}
+
+void test_radix_sort_signed() {
+    std::mt19937_64 rng(2);
+    std::vector<std::int64_t> values(3000);
+    for (auto& v : values) v = static_cast<std::int64_t>(rng());
+    values.push_back(std::numeric_limits<std::int64_t>::min());
+    values.push_back(std::numeric_limits<std::int64_t>::max());
+    values.push_back(0);
+    values.push_back(-1);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    algorithms::sorting::radix_sort(values.begin(), values.end());
+    assert(values == expected);
+
+    std::vector<std::int8_t> small = {5, -3, 127, -128, 0, -1, 1};
+    algorithms::sorting::radix_sort(small.begin(), small.end());
+    assert((small == std::vector<std::int8_t>{-128, -3, -1, 0, 1, 5, 127}));
+
+    std::vector<int> ints(200);
+    for (auto& v : ints) v = static_cast<int>(rng() % 2001) - 1000;
+    auto expected_ints = ints;
+    std::sort(expected_ints.begin(), expected_ints.end());
+    algorithms::sorting::radix_sort(ints.begin(), ints.end());
+    assert(ints == expected_ints);
+
+    std::cout << "Radix sort signed test passed!" << std::endl;
+}
+
+void test_radix_sort_floating_point() {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<double> values(4000);
+    for (auto& v : values) v = dist(rng);
+    values.push_back(std::numeric_limits<double>::infinity());
+    values.push_back(-std::numeric_limits<double>::infinity());
+    values.push_back(std::numeric_limits<double>::denorm_min());
+    values.push_back(-std::numeric_limits<double>::denorm_min());
+    values.push_back(0.0);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    algorithms::sorting::radix_sort(values.begin(), values.end());
+    assert(values == expected);
+
+    std::vector<float> floats = {1.5f, -0.0f, 0.0f, -2.25f, 3.0f, -0.0f};
+    algorithms::sorting::radix_sort(floats.begin(), floats.end());
+    assert(floats[0] == -2.25f);
+    assert(std::signbit(floats[1]) && std::signbit(floats[2]) && !std::signbit(floats[3]));
+    assert(floats[4] == 1.5f && floats[5] == 3.0f);
+
+    std::cout << "Radix sort floating point test passed!" << std::endl;
+}
+
+void test_radix_sort_projection() {
+    // Few distinct keys with random payloads: equal keys must keep their order
+    std::mt19937 rng(4);
+    std::vector<std::pair<std::int32_t, int>> records;
+    for (int i = 0; i < 5000; ++i) {
+        records.emplace_back(static_cast<std::int32_t>(rng() % 50) - 25, i);
+    }
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    algorithms::sorting::radix_sort(records.begin(), records.end(), &std::pair<std::int32_t, int>::first);
+    assert(records == expected);
+
+    // Move-only elements sorted by a projected key
+    std::vector<std::unique_ptr<std::uint16_t>> boxed;
+    for (int i = 0; i < 300; ++i) boxed.push_back(std::make_unique<std::uint16_t>(static_cast<std::uint16_t>(rng())));
+    algorithms::sorting::radix_sort(boxed.begin(), boxed.end(), [](const auto& p) { return *p; });
+    assert(std::is_sorted(boxed.begin(), boxed.end(), [](const auto& a, const auto& b) { return *a < *b; }));
+
+    std::vector<std::string> words = {"ccc", "a", "bb", "", "dddd"};
+    algorithms::sorting::radix_sort(words.begin(), words.end(), [](const std::string& w) { return w.size(); });
+    assert((words == std::vector<std::string>{"", "a", "bb", "ccc", "dddd"}));
+
+    std::cout << "Radix sort projection test passed!" << std::endl;
+}
+
+void test_radix_sort_constant_digits() {
+    // Timestamps sharing their high bytes only need the low digit passes
+    std::mt19937 rng(5);
+    const std::uint64_t base = 1'700'000'000'000ULL;
+    std::vector<std::uint64_t> stamps(10000);
+    for (auto& s : stamps) s = base + rng() % 100000;
+    auto expected = stamps;
+    std::sort(expected.begin(), expected.end());
+    algorithms::sorting::radix_sort(stamps.begin(), stamps.end());
+    assert(stamps == expected);
+
+    std::vector<std::uint32_t> same(1000, 42);
+    algorithms::sorting::radix_sort(same.begin(), same.end());
+    assert(std::all_of(same.begin(), same.end(), [](auto v) { return v == 42; }));
+
+    std::cout << "Radix sort constant digits test passed!" << std::endl;
+}
+
+void test_radix_sort_allocator() {
+    std::vector<std::uint32_t> data(1000);
+    std::mt19937 engine(7);
+    for (auto& value : data) value = engine();
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    // The buffer must come from the arena: it has no upstream to fall back on
+    alignas(std::max_align_t) std::byte storage[8192];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+    algorithms::sorting::radix_sort(data.begin(), data.end(), std::identity{},
+                                    std::pmr::polymorphic_allocator<>(&arena));
+    assert(data == expected);
+
+    // With every digit constant no pass runs, so no buffer is allocated at all
+    std::vector<std::uint32_t> same(1000, 42);
+    algorithms::sorting::radix_sort(same.begin(), same.end(), std::identity{},
+                                    std::pmr::polymorphic_allocator<>(std::pmr::null_memory_resource()));
+    assert(std::all_of(same.begin(), same.end(), [](auto v) { return v == 42; }));
+
+    std::cout << "Radix sort allocator test passed!" << std::endl;
+}
+
+int main() {
+    test_radix_sort_unsigned();
+    test_radix_sort_signed();
+    test_radix_sort_floating_point();
+    test_radix_sort_projection();
+    test_radix_sort_constant_digits();
+    test_radix_sort_allocator();
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}